@@ -16,7 +16,7 @@ emcc -I./src/stereo -I./src/stereo/Common src/stereo/LVCS_Tables.c src/stereo/LV
     -O3 \
     --closure 1 \
     -s EXPORTED_RUNTIME_METHODS="['ccall', 'UTF8ToString']" \
-    -s EXPORTED_FUNCTIONS="['_getStereoLevel','_setStereoLevel','_getReverbLevel','_setReverbLevel','_getHeadphoneMode','_setHeadphoneMode','_getCutoff6581', '_getFilterConfig6581', '_setFilterConfig6581', '_loadSidFile', '_playTune', '_getMusicInfo', '_getSampleRate', '_getSoundBuffer', '_getSoundBufferLen', '_computeAudioSamples', '_enableVoices', '_envIsSID6581', '_envSetSID6581', '_envIsNTSC', '_envSetNTSC', '_getBufferVoice1', '_getBufferVoice2', '_getBufferVoice3', '_getBufferVoice4', '_setRegisterSID', '_getRegisterSID', '_getRAM', '_setRAM', '_getDigiType', '_getDigiTypeDesc', '_getDigiRate', '_getNumberTraceStreams', '_getTraceStreams', '_countSIDs', '_getSIDRegister', '_getSIDRegister2', '_setSIDRegister', '_getSIDBaseAddr', '_readVoiceLevel', '_initPanningCfg', '_getPanning', '_setPanning', '_malloc', '_free']" \
+    -s EXPORTED_FUNCTIONS="['_getStereoLevel','_setStereoLevel','_getReverbLevel','_setReverbLevel','_getHeadphoneMode','_setHeadphoneMode','_getCutoff6581', '_getFilterConfig6581', '_setFilterConfig6581', '_setFixedPointFilter', '_isFixedPointFilter', '_loadCombinedWaveforms', '_loadSidFile', '_playTune', '_getMusicInfo', '_getSampleRate', '_getSoundBuffer', '_getSoundBufferLen', '_computeAudioSamples', '_warpTo', '_skipSilence', '_enableVoices', '_envIsSID6581', '_envSetSID6581', '_envIsNTSC', '_envSetNTSC', '_getBufferVoice1', '_getBufferVoice2', '_getBufferVoice3', '_getBufferVoice4', '_setRegisterSID', '_getRegisterSID', '_getRAM', '_setRAM', '_getDigiType', '_getDigiTypeDesc', '_getDigiRate', '_getNumberTraceStreams', '_getTraceStreams', '_countSIDs', '_getSIDRegister', '_getSIDRegister2', '_setSIDRegister', '_getSIDBaseAddr', '_readVoiceLevel', '_initPanningCfg', '_getPanning', '_setPanning', '_malloc', '_free']" \
     -o htdocs/sid.js \
     -s SINGLE_FILE=1 \
     -s BINARYEN_ASYNC_COMPILATION=0 \
@@ -0,0 +1,58 @@
+/*
+* Minimal 16-bit stereo PCM/WAV output used by the command line tools.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <string.h>
+
+#include "wav_file.h"
+
+static void put16(uint8_t* dest, uint16_t v) {
+	dest[0] = v & 0xff;
+	dest[1] = v >> 8;
+}
+
+static void put32(uint8_t* dest, uint32_t v) {
+	put16(dest, v & 0xffff);
+	put16(dest + 2, v >> 16);
+}
+
+void wavWriteHeader(FILE* out, uint32_t sample_rate, uint32_t data_bytes) {
+	uint8_t h[44];
+	memcpy(h, "RIFF", 4);
+	put32(h + 4, 36 + data_bytes);
+	memcpy(h + 8, "WAVEfmt ", 8);
+	put32(h + 16, 16);							// PCM fmt chunk size
+	put16(h + 20, 1);							// PCM
+	put16(h + 22, CHANNELS);
+	put32(h + 24, sample_rate);
+	put32(h + 28, sample_rate * CHANNELS * sizeof(int16_t));
+	put16(h + 32, CHANNELS * sizeof(int16_t));
+	put16(h + 34, 16);							// bits per sample
+	memcpy(h + 36, "data", 4);
+	put32(h + 40, data_bytes);
+
+	fwrite(h, 1, sizeof(h), out);
+}
+
+static uint8_t isBigEndian() {
+	uint16_t test = 1;
+	return ((uint8_t*)&test)[0] == 0;
+}
+
+void wavWriteSamples(FILE* out, int16_t* buffer, uint32_t samples) {
+	if (isBigEndian()) {
+		for (uint32_t i = 0; i < samples * CHANNELS; i++) {
+			uint8_t le[2];
+			put16(le, (uint16_t)buffer[i]);
+			fwrite(le, 1, 2, out);
+		}
+	} else {
+		fwrite(buffer, sizeof(int16_t) * CHANNELS, samples, out);
+	}
+}
@@ -0,0 +1,28 @@
+/*
+* Minimal 16-bit stereo PCM/WAV output used by the command line tools.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_WAV_FILE_H
+#define WEBSID_WAV_FILE_H
+
+#include <stdio.h>
+
+extern "C" {
+#include "base.h"
+}
+
+#define CHANNELS 2
+
+void wavWriteHeader(FILE* out, uint32_t sample_rate, uint32_t data_bytes);
+
+/**
+* Writes interleaved stereo samples as 16-bit signed little endian data.
+*/
+void wavWriteSamples(FILE* out, int16_t* buffer, uint32_t samples);
+
+#endif
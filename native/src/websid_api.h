@@ -0,0 +1,80 @@
+/*
+* Declarations of the player API exported by src/sidplayer.cpp.
+*
+* In the browser these functions are accessed via "ccall" (see tinyrsid_adapter.js)
+* and there is no C header for them. Native programs link against "libwebsid.a"
+* and use this file instead.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_API_H
+#define WEBSID_API_H
+
+extern "C" {
+#include "base.h"
+
+uint32_t loadSidFile(uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+					uint32_t sample_rate, char* filename, void* basic_ROM,
+					void* char_ROM, void* kernal_ROM);
+uint32_t playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize);
+
+/**
+* @return 1 if the PSID INIT routine of the track started by playTune() did not complete
+*/
+uint8_t isInitTimeout();
+
+/**
+* Renders the next chunk of audio into the buffer returned by getSoundBuffer().
+*
+* @return number of (stereo) samples, 0 if not ready or -1 at the end of the track
+*/
+int32_t computeAudioSamples();
+
+/**
+* Fast forwards (without audio output) to the specified playback position, i.e.
+* milliseconds since playTune(). Use playTune() to go backwards.
+*
+* @return number of skipped milliseconds
+*/
+uint32_t warpTo(uint32_t ms);
+
+/**
+* Fast forwards (without audio output) until the song first becomes audible -
+* but at most by max_ms.
+*
+* @return number of skipped milliseconds
+*/
+uint32_t skipSilence(uint32_t max_ms);
+char* getSoundBuffer();
+uint32_t getSoundBufferLen();
+uint32_t getSampleRate();
+
+char** getMusicInfo();
+int countSIDs();
+
+uint8_t envIsSID6581();
+uint8_t envSetSID6581(uint8_t is6581);
+uint8_t envIsNTSC();
+uint8_t envSetNTSC(uint8_t is_ntsc);
+
+/**
+* Selects the integer (Q-format) instead of the "double" based filter implementation
+* (see Filter::setFixedPoint). Should be set before playTune() is called.
+*/
+void setFixedPointFilter(uint8_t on);
+uint8_t isFixedPointFilter();
+
+/**
+* Replaces the built-in "combined waveform" tables of the calling thread (see
+* WaveGenerator::loadCombinedWaveforms), use 0 to restore the built-in tables.
+*
+* @return 0 on success
+*/
+uint32_t loadCombinedWaveforms(void* in_buffer, uint32_t in_buf_size);
+}
+
+#endif
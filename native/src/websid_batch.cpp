@@ -0,0 +1,593 @@
+/*
+* Batch renderer: renders a whole corpus of songs (e.g. HVSC) using all the
+* available CPU cores.
+*
+* Each worker thread owns one EmulatorContext (see context.h) which is reused
+* for all the jobs that the worker processes, i.e. the emulator is set up
+* once per thread and not once per song. Jobs are initially distributed
+* evenly across per-worker queues; a worker that runs out of work steals
+* jobs from the other queues (songs vary wildly in their emulation cost).
+*
+* The result of each job is written as one CSV line to the summary (as soon
+* as the job is completed, i.e. the summary of an aborted run is still
+* usable).
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>	// strcasecmp
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "context.h"
+#include "wav_file.h"
+extern "C" {
+#include "system.h"
+}
+
+#define SONG_FILE_MAX 0x10000 + 0x7c + 0x200	// 64k plus header plus some slack
+#define DEFAULT_SAMPLE_RATE 44100
+#define DEFAULT_DURATION 180
+
+
+struct Job {
+	std::string file;
+	std::string output;		// empty: render without output
+	int32_t track;			// 0-based, -1 means the song's default
+	double duration;
+	int8_t model;			// -1 means "use setting from file"
+};
+
+struct BatchOptions {
+	const char* output_dir;		// 0: no output files
+	const char* summary;		// 0: stdout
+	const char* job_list;
+	uint32_t sample_rate;
+	double duration;
+	int8_t model;
+	uint32_t threads;
+	uint8_t all_tracks;
+	uint8_t keep;
+};
+
+static void showHelp(char *argv[]) {
+	fprintf(stderr, "Usage: %s [Options] [song files or folders]\n", argv[0]);
+	fprintf(stderr, "Options: \n");
+	fprintf(stderr, " -l, --list     : file with one job per line: <song>[TAB<track>[TAB<seconds>[TAB<model>]]]\n");
+	fprintf(stderr, " -o, --output   : folder for the rendered WAV files (default: render without output)\n");
+	fprintf(stderr, " -s, --summary  : CSV summary file (default: stdout)\n");
+	fprintf(stderr, " -j, --jobs     : number of worker threads (default: number of cores)\n");
+	fprintf(stderr, " -a, --all      : render all the tracks of songs found in folders/listed without track\n");
+	fprintf(stderr, " -k, --keep     : skip jobs whose output file already exists\n");
+	fprintf(stderr, " -r, --rate     : sample rate in Hz (default: %d, max: 48000)\n", DEFAULT_SAMPLE_RATE);
+	fprintf(stderr, " -d, --duration : default seconds to render per job (default: %d)\n", DEFAULT_DURATION);
+	fprintf(stderr, " -m, --model    : force SID model '6581' or '8580' (unless specified by the job)\n");
+	fprintf(stderr, " -h, --help     : show this help message\n\n");
+	fprintf(stderr, "Folders are searched recursively for .sid and .mus files. Tracks are 1-based.\n");
+	fprintf(stderr, "Output files are named like the listed songs relative to their common folder (plus the track\n");
+	fprintf(stderr, "and the model if specified by the job). Jobs that would write the same file are rejected.\n");
+	exit(1);
+}
+
+static const char* nextArg(int argc, char *argv[], int *i) {
+	if (++(*i) >= argc) {
+		fprintf(stderr, "error: missing value for %s\n", argv[(*i) - 1]);
+		exit(1);
+	}
+	return argv[*i];
+}
+
+static int8_t parseModel(const char* m) {
+	if (!strcmp(m, "6581")) return 1;
+	if (!strcmp(m, "8580")) return 0;
+	fprintf(stderr, "error: unsupported SID model: %s\n", m);
+	exit(1);
+}
+
+static uint8_t endsWith(const std::string& str, const char* suffix) {
+	size_t s = strlen(suffix);
+	return (str.size() >= s) && !strcasecmp(str.c_str() + str.size() - s, suffix);
+}
+
+static uint8_t isSongFile(const std::string& name) {
+	return endsWith(name, ".sid") || endsWith(name, ".mus");
+}
+
+static uint8_t isFolder(const char* path) {
+	struct stat s;
+	return !stat(path, &s) && S_ISDIR(s.st_mode);
+}
+
+// ----------------- job creation -----------------------------------------
+
+static uint16_t countTracks(const std::string& file) {
+	// .mus files only contain one track
+	uint8_t h[0x10];
+	FILE* f = fopen(file.c_str(), "rb");
+	if (!f) return 1;
+
+	size_t n = fread(h, 1, sizeof(h), f);
+	fclose(f);
+
+	if ((n < sizeof(h)) || (memcmp(h + 1, "SID", 3)) || ((h[0] != 'P') && (h[0] != 'R'))) return 1;
+
+	uint16_t songs = (h[0x0e] << 8) | h[0x0f];
+	return songs ? songs : 1;
+}
+
+static std::string outputName(const BatchOptions* opt, const std::string& rel_name, int32_t track,
+								const char* suffix) {
+	if (!opt->output_dir) return "";
+
+	std::string name = rel_name.substr(0, rel_name.size() - 4);	// strip .sid/.mus
+	if (track >= 0) name += "-" + std::to_string(track + 1);
+	name += suffix;
+
+	return std::string(opt->output_dir) + "/" + name + ".wav";
+}
+
+static void addJob(std::vector<Job>& jobs, const BatchOptions* opt, const std::string& file,
+					const std::string& rel_name, int32_t track, double duration, int8_t model,
+					const char* suffix = "") {
+
+	if ((track < 0) && opt->all_tracks) {
+		uint16_t n = countTracks(file);
+		for (uint16_t t = 0; t < n; t++) {
+			addJob(jobs, opt, file, rel_name, t, duration, model, suffix);
+		}
+		return;
+	}
+	Job j;
+	j.file = file;
+	j.output = outputName(opt, rel_name, track, suffix);
+	j.track = track;
+	j.duration = duration;
+	j.model = model;
+	jobs.push_back(j);
+}
+
+static void scanFolder(std::vector<Job>& jobs, const BatchOptions* opt, const std::string& root,
+						const std::string& rel_path) {
+
+	std::string path = rel_path.empty() ? root : root + "/" + rel_path;
+	DIR* dir = opendir(path.c_str());
+	if (!dir) {
+		fprintf(stderr, "warning: cannot read folder: %s\n", path.c_str());
+		return;
+	}
+	std::vector<std::string> names;
+	struct dirent* e;
+	while ((e = readdir(dir))) {
+		if (e->d_name[0] != '.') names.push_back(e->d_name);
+	}
+	closedir(dir);
+
+	std::sort(names.begin(), names.end());	// make the job order reproducible
+
+	for (size_t i = 0; i < names.size(); i++) {
+		std::string rel = rel_path.empty() ? names[i] : rel_path + "/" + names[i];
+		std::string file = root + "/" + rel;
+
+		if (isFolder(file.c_str())) {
+			scanFolder(jobs, opt, root, rel);
+		} else if (isSongFile(names[i])) {
+			addJob(jobs, opt, file, rel, -1, opt->duration, opt->model);
+		}
+	}
+}
+
+static std::string baseName(const std::string& file) {
+	size_t p = file.find_last_of('/');
+	return p == std::string::npos ? file : file.substr(p + 1);
+}
+
+// length of the folder part that all the files have in common (including the '/')
+static size_t commonFolderLength(const std::vector<std::string>& files) {
+	if (files.empty()) return 0;
+
+	std::string common = files[0].substr(0, files[0].find_last_of('/') + 1);
+	for (size_t i = 1; i < files.size(); i++) {
+		size_t n = 0;
+		while ((n < common.size()) && (n < files[i].size()) && (files[i][n] == common[n])) n++;
+		common.resize(n);
+	}
+	return common.find_last_of('/') + 1;	// only whole folder names (0 if there is none)
+}
+
+// file name relative to the common folder of the job list (i.e. like in scanFolder
+// songs from different folders do not end up in the same output file)
+static std::string relativeName(const std::string& file, size_t common_len) {
+	std::string rel = file.substr(common_len);
+
+	// the output must stay within the output folder
+	size_t p;
+	while ((p = rel.find("../")) != std::string::npos) rel.replace(p, 3, "__/");
+	while (!rel.empty() && (rel[0] == '/')) rel.erase(0, 1);
+	return rel;
+}
+
+static void readJobList(std::vector<Job>& jobs, const BatchOptions* opt) {
+	FILE* f = fopen(opt->job_list, "r");
+	if (!f) {
+		fprintf(stderr, "error: file not found: %s\n", opt->job_list);
+		exit(1);
+	}
+	struct ListEntry {
+		std::string file;
+		int32_t track;
+		double duration;
+		int8_t model;
+		uint8_t has_model;
+	};
+	std::vector<ListEntry> entries;
+	std::vector<std::string> files;
+
+	char line[4096];
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\r\n")] = 0;
+		if (!line[0] || (line[0] == '#')) continue;
+
+		// fields are TAB separated (song file names may contain blanks)
+		char* fields[4] = {0, 0, 0, 0};
+		char* p = line;
+		for (int i = 0; (i < 4) && p; i++) {
+			fields[i] = p;
+			p = strchr(p, '\t');
+			if (p) *(p++) = 0;
+		}
+		int32_t track = (fields[1] && fields[1][0]) ? atoi(fields[1]) - 1 : -1;
+		double duration = (fields[2] && fields[2][0]) ? atof(fields[2]) : opt->duration;
+		uint8_t has_model = fields[3] && fields[3][0];
+		int8_t model = has_model ? parseModel(fields[3]) : opt->model;
+
+		ListEntry e = { fields[0], track, duration, model, has_model };
+		entries.push_back(e);
+		files.push_back(e.file);
+	}
+	fclose(f);
+
+	size_t common_len = commonFolderLength(files);
+
+	for (size_t i = 0; i < entries.size(); i++) {
+		const ListEntry* e = &entries[i];
+
+		// the same song may be listed for both models
+		const char* suffix = !e->has_model ? "" : (e->model ? "-6581" : "-8580");
+		addJob(jobs, opt, e->file, relativeName(e->file, common_len), e->track, e->duration, e->model, suffix);
+	}
+}
+
+// concurrent workers must never write the same output file
+static uint8_t checkOutputNames(const std::vector<Job>& jobs) {
+	std::map<std::string, size_t> used;
+	uint8_t ok = 1;
+	for (size_t i = 0; i < jobs.size(); i++) {
+		if (jobs[i].output.empty()) continue;
+
+		std::map<std::string, size_t>::iterator it = used.find(jobs[i].output);
+		if (it != used.end()) {
+			fprintf(stderr, "error: output file used by more than one job: %s (%s, %s)\n",
+					jobs[i].output.c_str(), jobs[it->second].file.c_str(), jobs[i].file.c_str());
+			ok = 0;
+		} else {
+			used[jobs[i].output] = i;
+		}
+	}
+	return ok;
+}
+
+// ----------------- work stealing -----------------------------------------
+
+/**
+* Job queue of one worker. The owner takes jobs from the back while other
+* workers steal from the front.
+*/
+class JobQueue {
+	std::mutex _mtx;
+	std::deque<uint32_t> _jobs;
+public:
+	void push(uint32_t idx) {
+		std::lock_guard<std::mutex> lock(_mtx);
+		_jobs.push_back(idx);
+	}
+	bool take(uint32_t* idx) {
+		std::lock_guard<std::mutex> lock(_mtx);
+		if (_jobs.empty()) return false;
+		*idx = _jobs.back();
+		_jobs.pop_back();
+		return true;
+	}
+	bool steal(uint32_t* idx) {
+		std::lock_guard<std::mutex> lock(_mtx);
+		if (_jobs.empty()) return false;
+		*idx = _jobs.front();
+		_jobs.pop_front();
+		return true;
+	}
+};
+
+// no jobs are added once the workers are running, i.e. a worker is done
+// when all the queues are empty
+static bool nextJob(JobQueue* queues, uint32_t count, uint32_t self, uint32_t* idx) {
+	if (queues[self].take(idx)) return true;
+
+	for (uint32_t i = 1; i < count; i++) {
+		if (queues[(self + i) % count].steal(idx)) return true;
+	}
+	return false;
+}
+
+// ----------------- rendering -----------------------------------------
+
+struct JobResult {
+	const char* status;
+	int32_t track;			// 1-based track that was actually played
+	int8_t model;
+	uint32_t samples;
+	uint32_t sample_rate;
+	double secs;
+	uint8_t has_output;		// output file has been written
+};
+
+static std::mutex _summary_mutex;
+
+static void makeParentFolders(const std::string& path) {
+	for (size_t p = path.find('/', 1); p != std::string::npos; p = path.find('/', p + 1)) {
+		mkdir(path.substr(0, p).c_str(), 0755);	// existing folders are fine
+	}
+}
+
+static uint8_t fileExists(const std::string& path) {
+	struct stat s;
+	return !stat(path.c_str(), &s);
+}
+
+static void render(EmulatorContext* ctx, const Job* job, uint32_t sample_rate, uint8_t* buffer,
+					JobResult* result) {
+
+	FILE* file = fopen(job->file.c_str(), "rb");
+	if (!file) {
+		result->status = "load_error";
+		return;
+	}
+	uint32_t size = fread(buffer, 1, SONG_FILE_MAX, file);
+	fclose(file);
+
+	uint8_t is_mus = endsWith(job->file, ".mus");
+	if (ctxLoadSidFile(ctx, is_mus, buffer, size, sample_rate, (char*)job->file.c_str(), 0, 0, 0)) {
+		result->status = "load_error";
+		return;
+	}
+
+	// overrides must be applied before the tune is started
+	if (job->model >= 0) ctxSetSID6581(ctx, job->model);
+
+	ctxPlayTune(ctx, job->track, 0, 0);
+
+	result->track = *((uint8_t*)ctxGetMusicInfo(ctx)[3]) + 1;
+	result->model = ctxIsSID6581(ctx);
+	result->sample_rate = ctxGetSampleRate(ctx);
+
+	if (ctxIsInitTimeout(ctx)) {
+		result->status = "init_timeout";
+		return;
+	}
+
+	FILE* out = 0;
+	if (!job->output.empty()) {
+		makeParentFolders(job->output);
+		out = fopen(job->output.c_str(), "wb");
+		if (!out) {
+			result->status = "io_error";
+			return;
+		}
+		result->has_output = 1;
+	}
+
+	uint32_t total = (uint32_t)(job->duration * result->sample_rate);
+	if (out) wavWriteHeader(out, result->sample_rate, total * CHANNELS * sizeof(int16_t));
+
+	while (result->samples < total) {
+		int32_t n = ctxComputeAudioSamples(ctx);
+		if (n <= 0) break;		// end of track
+
+		if (result->samples + n > total) n = total - result->samples;
+
+		if (out) wavWriteSamples(out, ctxGetSoundBuffer(ctx), n);
+		result->samples += n;
+	}
+
+	result->status = "ok";
+	if (out) {
+		if (result->samples < total) {
+			// song ended early: fix the header
+			fseek(out, 0, SEEK_SET);
+			wavWriteHeader(out, result->sample_rate, result->samples * CHANNELS * sizeof(int16_t));
+		}
+		if (ferror(out)) result->status = "io_error";
+		fclose(out);
+	}
+}
+
+static void writeCsvString(FILE* out, const std::string& s) {
+	fputc('"', out);
+	for (size_t i = 0; i < s.size(); i++) {
+		if (s[i] == '"') fputc('"', out);
+		fputc(s[i], out);
+	}
+	fputc('"', out);
+}
+
+static void reportResult(FILE* summary, uint32_t idx, const Job* job, const JobResult* r) {
+	double seconds = r->sample_rate ? ((double)r->samples) / r->sample_rate : 0;
+
+	std::lock_guard<std::mutex> lock(_summary_mutex);
+	fprintf(summary, "%u,", idx);
+	writeCsvString(summary, job->file);
+	if (r->track > 0) {
+		fprintf(summary, ",%d", r->track);
+	} else {
+		fprintf(summary, ",");		// song's default track (not loaded)
+	}
+	fprintf(summary, ",%s,%.2f,%s,%u,%.3f,%.1f,",
+			r->model < 0 ? "" : (r->model ? "6581" : "8580"), job->duration, r->status,
+			r->samples, r->secs, r->secs > 0 ? seconds / r->secs : 0);
+	writeCsvString(summary, r->has_output ? job->output : "");
+	fputc('\n', summary);
+	fflush(summary);
+}
+
+struct WorkerStats {
+	uint32_t done;
+	uint32_t failed;
+};
+
+static void runWorker(const BatchOptions* opt, const std::vector<Job>* jobs, JobQueue* queues,
+						uint32_t self, FILE* summary, WorkerStats* stats) {
+
+	EmulatorContext* ctx = ctxCreate();
+	uint8_t* buffer = (uint8_t*)malloc(SONG_FILE_MAX);
+
+	uint32_t idx;
+	while (nextJob(queues, opt->threads, self, &idx)) {
+		const Job* job = &(*jobs)[idx];
+
+		JobResult r;
+		memset(&r, 0, sizeof(r));
+		r.track = job->track + 1;
+		r.model = job->model;
+
+		if (opt->keep && !job->output.empty() && fileExists(job->output)) {
+			r.status = "skipped";
+		} else {
+			double start = sysTimeSecs();
+			render(ctx, job, opt->sample_rate, buffer, &r);
+			r.secs = sysTimeSecs() - start;
+		}
+		reportResult(summary, idx, job, &r);
+
+		stats->done++;
+		if (strcmp(r.status, "ok") && strcmp(r.status, "skipped")) stats->failed++;
+	}
+	free(buffer);
+	ctxDestroy(ctx);
+}
+
+int main(int argc, char *argv[]) {
+	BatchOptions opt;
+	memset(&opt, 0, sizeof(opt));
+	opt.sample_rate = DEFAULT_SAMPLE_RATE;
+	opt.duration = DEFAULT_DURATION;
+	opt.model = -1;
+	opt.threads = std::thread::hardware_concurrency();
+
+	std::vector<const char*> inputs;
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+
+		if (a[0] != '-') {
+			inputs.push_back(a);
+		} else if (!strcmp(a, "-l") || !strcmp(a, "--list")) {
+			opt.job_list = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-o") || !strcmp(a, "--output")) {
+			opt.output_dir = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-s") || !strcmp(a, "--summary")) {
+			opt.summary = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-j") || !strcmp(a, "--jobs")) {
+			opt.threads = atoi(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-a") || !strcmp(a, "--all")) {
+			opt.all_tracks = 1;
+		} else if (!strcmp(a, "-k") || !strcmp(a, "--keep")) {
+			opt.keep = 1;
+		} else if (!strcmp(a, "-r") || !strcmp(a, "--rate")) {
+			opt.sample_rate = atoi(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-d") || !strcmp(a, "--duration")) {
+			opt.duration = atof(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-m") || !strcmp(a, "--model")) {
+			opt.model = parseModel(nextArg(argc, argv, &i));
+		} else {
+			showHelp(argv);
+		}
+	}
+	if ((inputs.empty() && !opt.job_list) || !opt.sample_rate || (opt.duration <= 0)) showHelp(argv);
+
+	// collect the jobs
+	std::vector<Job> jobs;
+	if (opt.job_list) readJobList(jobs, &opt);
+
+	for (size_t i = 0; i < inputs.size(); i++) {
+		std::string in = inputs[i];
+		if (isFolder(in.c_str())) {
+			while ((in.size() > 1) && (in[in.size() - 1] == '/')) in.resize(in.size() - 1);
+			scanFolder(jobs, &opt, in, "");
+		} else {
+			addJob(jobs, &opt, in, baseName(in), -1, opt.duration, opt.model);
+		}
+	}
+	if (jobs.empty()) {
+		fprintf(stderr, "error: no songs found\n");
+		return 1;
+	}
+	if (!checkOutputNames(jobs)) return 1;
+
+	FILE* summary = stdout;
+	if (opt.summary) {
+		summary = fopen(opt.summary, "w");
+		if (!summary) {
+			fprintf(stderr, "error: cannot create summary file: %s\n", opt.summary);
+			return 1;
+		}
+	}
+	fprintf(summary, "job,file,track,model,duration,status,samples,secs,realtime_factor,output\n");
+
+	if (!opt.threads) opt.threads = 1;
+	if (opt.threads > jobs.size()) opt.threads = jobs.size();
+
+	// distribute the jobs round robin, i.e. each worker initially gets a mix
+	// of the songs from the different folders
+	JobQueue* queues = new JobQueue[opt.threads];
+	for (uint32_t i = 0; i < jobs.size(); i++) {
+		queues[i % opt.threads].push(i);
+	}
+
+	std::vector<WorkerStats> stats(opt.threads);
+	std::vector<std::thread> workers;
+
+	double start = sysTimeSecs();
+	for (uint32_t i = 0; i < opt.threads; i++) {
+		memset(&stats[i], 0, sizeof(WorkerStats));
+		workers.push_back(std::thread(runWorker, &opt, &jobs, queues, i, summary, &stats[i]));
+	}
+	for (uint32_t i = 0; i < opt.threads; i++) {
+		workers[i].join();
+	}
+	double secs = sysTimeSecs() - start;
+
+	uint32_t failed = 0;
+	for (uint32_t i = 0; i < opt.threads; i++) {
+		failed += stats[i].failed;
+	}
+	fprintf(stderr, "%u jobs (%u failed) on %u threads in %.2f secs\n", (uint32_t)jobs.size(), failed,
+			opt.threads, secs);
+
+	if (summary != stdout) fclose(summary);
+	delete[] queues;
+
+	return failed ? 2 : 0;
+}
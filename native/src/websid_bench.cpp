@@ -0,0 +1,379 @@
+/*
+* Benchmark: renders a fixed duration of each of the specified songs (plus some
+* synthetic stress cases) as fast as possible and reports how quickly the
+* emulation runs and where the time is spent.
+*
+* Each song is rendered twice: The 1st (regular) run measures the throughput
+* and the 2nd (instrumented, see Core::setPerfStats) run measures the split
+* between the system emulation (sysClockEvents or, with -x, sysClockOpt/sysClock),
+* SID::clockAll and the SID::synthSamples*() functions. (The instrumented run is
+* somewhat slower and its absolute numbers should therefore not be compared with
+* the 1st run.)
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>	// strcasecmp
+
+#include "websid_api.h"
+
+#include "core.h"
+#include "loaders.h"
+extern "C" {
+#include "system.h"
+}
+
+#define SONG_FILE_MAX 0x10000 + 0x7c + 0x200	// 64k plus header plus some slack
+#define DEFAULT_SAMPLE_RATE 44100
+#define DEFAULT_DURATION 20
+
+#define SID_HEADER_SIZE 0x7c
+
+struct BenchCase {
+	const char* name;
+	uint8_t* data;
+	uint32_t size;
+};
+
+struct BenchResult {
+	uint64_t cycles;	// sysCycles() wraps after about 72 minutes
+	uint32_t samples;
+	double secs;
+};
+
+
+// ----------------- synthetic stress cases -----------------------------------------
+
+/**
+* Poor man's 6502 "assembler" used to create the synthetic test songs.
+*/
+class CodeBuffer {
+public:
+	CodeBuffer(uint16_t org) { _org = org; _pos = 0; }
+
+	uint16_t here() { return _org + _pos; }
+	uint16_t size() { return _pos; }
+	uint8_t* data() { return _code; }
+
+	void op(uint8_t opc) { _code[_pos++] = opc; }
+	void op8(uint8_t opc, uint8_t v) { op(opc); op(v); }
+	void op16(uint8_t opc, uint16_t addr) { op(opc); op(addr & 0xff); op(addr >> 8); }
+
+	void patch16(uint16_t at, uint16_t addr) {
+		_code[at - _org] = addr & 0xff;
+		_code[at - _org + 1] = addr >> 8;
+	}
+	void store(uint16_t addr, uint8_t v) {
+		op8(0xa9, v);		// LDA #v
+		op16(0x8d, addr);	// STA addr
+	}
+private:
+	uint16_t _org;
+	uint16_t _pos;
+	uint8_t _code[0x1000];
+};
+
+static const uint8_t VOICE_CTRL[3] = { 0x41, 0x21, 0x11 };	// pulse, saw, triangle
+
+static uint8_t* createSidFile(const char* magic, uint8_t version, uint16_t load_addr,
+							uint16_t init_addr, uint16_t play_addr, uint8_t* ext_sids,
+							uint8_t ext_sids_len, CodeBuffer* code, uint32_t* size) {
+
+	uint16_t header_size = SID_HEADER_SIZE + ext_sids_len;
+
+	*size = header_size + 2 + code->size();
+	uint8_t* buf = (uint8_t*)calloc(1, *size);
+
+	memcpy(buf, magic, 4);
+	buf[0x05] = version;
+	buf[0x07] = header_size;
+	// load address is stored in front of the binary (as required for RSID)
+	buf[0x0a] = init_addr >> 8;
+	buf[0x0b] = init_addr & 0xff;
+	buf[0x0c] = play_addr >> 8;
+	buf[0x0d] = play_addr & 0xff;
+	buf[0x0f] = 1;			// number of songs
+	buf[0x11] = 1;			// start song
+	strcpy((char*)buf + 0x16, "synthetic stress case");
+	strcpy((char*)buf + 0x36, "websid-bench");
+	if (ext_sids_len) memcpy(buf + 0x7a, ext_sids, ext_sids_len);
+
+	buf[header_size] = load_addr & 0xff;
+	buf[header_size + 1] = load_addr >> 8;
+	memcpy(buf + header_size + 2, code->data(), code->size());
+	return buf;
+}
+
+// raster driven PSID that plays all 3 voices of each of the specified SIDs
+static uint8_t* createRasterPSID(uint16_t* sid_addrs, uint8_t sid_count, uint8_t* ext_sids,
+									uint8_t ext_sids_len, uint32_t* size) {
+	CodeBuffer c(0x1000);
+
+	// INIT
+	for (uint8_t s= 0; s<sid_count; s++) {
+		uint16_t base = sid_addrs[s];
+		for (uint8_t v= 0; v<3; v++) {
+			c.store(base + 7*v + 5, 0x09);			// AD
+			c.store(base + 7*v + 6, 0xa9);			// SR
+			c.store(base + 7*v + 3, 0x08);			// pulse width
+			c.store(base + 7*v + 4, VOICE_CTRL[v]);
+		}
+		c.store(base + 0x16, 0x40);					// cutoff
+		c.store(base + 0x17, 0xf1);					// filter voice 1
+		c.store(base + 0x18, 0x1f);					// low pass & volume
+	}
+	c.op(0x60);										// RTS
+
+	// PLAY
+	uint16_t play_addr = c.here();
+	c.op8(0xe6, 0xfb);								// INC $FB
+	c.op8(0xa5, 0xfb);								// LDA $FB
+	for (uint8_t s= 0; s<sid_count; s++) {
+		for (uint8_t v= 0; v<3; v++) {
+			c.op16(0x8d, sid_addrs[s] + 7*v + 1);	// STA freq hi
+			c.op8(0x69, 0x05);						// ADC #$05
+		}
+	}
+	// retrigger the notes every 16 frames
+	c.op8(0xa5, 0xfb);								// LDA $FB
+	c.op8(0x29, 0x0f);								// AND #$0F
+	c.op8(0xf0, 0x03);								// BEQ +3
+	uint16_t jmp_pos = c.here();
+	c.op16(0x4c, 0);								// JMP done
+	for (uint8_t s= 0; s<sid_count; s++) {
+		for (uint8_t v= 0; v<3; v++) {
+			c.store(sid_addrs[s] + 7*v + 4, VOICE_CTRL[v] & 0xfe);
+			c.store(sid_addrs[s] + 7*v + 4, VOICE_CTRL[v]);
+		}
+	}
+	c.patch16(jmp_pos + 1, c.here());
+	c.op(0x60);										// RTS
+
+	uint8_t version = ext_sids_len ? 0x4e : 0x02;	// 0x4e: WebSid's "extended multi-SID" format
+	return createSidFile("PSID", version, 0x1000, 0x1000, play_addr, ext_sids, ext_sids_len, &c, size);
+}
+
+// RSID that plays 4-bit $D418 digis from a CIA 2 timer driven NMI (about 8kHz)
+static uint8_t* createNmiDigiRSID(uint32_t* size) {
+	CodeBuffer c(0x1000);
+
+	c.op(0x78);										// SEI
+	uint16_t vec_pos = c.here();
+	c.store(0x0318, 0);								// NMI vector (patched below)
+	c.store(0x0319, 0);
+	c.store(0xdd04, 0x7b);							// timer A: 123 cycles
+	c.store(0xdd05, 0x00);
+	c.store(0xdd0d, 0x81);							// enable timer A NMI
+	c.store(0xdd0e, 0x11);							// force load & start
+	uint16_t loop = c.here();
+	c.op16(0x4c, loop);								// JMP *
+
+	uint16_t nmi = c.here();
+	c.op(0x48);										// PHA
+	c.op16(0xad, 0xdd0d);							// LDA $DD0D (acknowledge)
+	c.op8(0xe6, 0xfb);								// INC $FB
+	c.op8(0xa5, 0xfb);								// LDA $FB
+	c.op8(0x29, 0x0f);								// AND #$0F
+	c.op16(0x8d, 0xd418);							// STA $D418
+	c.op(0x68);										// PLA
+	c.op(0x40);										// RTI
+
+	c.data()[vec_pos + 1 - 0x1000] = nmi & 0xff;
+	c.data()[vec_pos + 6 - 0x1000] = nmi >> 8;
+
+	return createSidFile("RSID", 0x02, 0x1000, 0x1000, 0, 0, 0, &c, size);
+}
+
+static void addSyntheticCases(struct BenchCase* cases, int* count) {
+	uint16_t single[1] = { 0xd400 };
+	cases[*count].name = "synthetic: raster PSID";
+	cases[*count].data = createRasterPSID(single, 1, 0, 0, &cases[*count].size);
+	(*count)++;
+
+	cases[*count].name = "synthetic: NMI digi RSID";
+	cases[*count].data = createNmiDigiRSID(&cases[*count].size);
+	(*count)++;
+
+	// extended multi-SID format: list of 16-bit entries (low byte: address "center byte")
+	uint16_t multi[8];
+	uint8_t ext[16];
+	memset(ext, 0, sizeof(ext));
+	multi[0] = 0xd400;
+	for (uint8_t i= 1; i<8; i++) {
+		uint8_t center = 0x40 + 2*i;		// $d420, $d440, ..
+		multi[i] = 0xd000 | (center << 4);
+		ext[2*(i - 1)] = center;
+	}
+	cases[*count].name = "synthetic: 8SID ext. multi-SID PSID";
+	cases[*count].data = createRasterPSID(multi, 8, ext, sizeof(ext), &cases[*count].size);
+	(*count)++;
+}
+
+// ----------------- benchmark -----------------------------------------
+
+static uint8_t* loadBuffer(const char* filename, uint32_t* size) {
+	FILE* file = fopen(filename, "rb");
+	if (file == NULL) {
+		fprintf(stderr, "error: file not found: %s\n", filename);
+		return 0;
+	}
+	uint8_t* buffer = (uint8_t*)malloc(SONG_FILE_MAX);
+	*size = fread(buffer, 1, SONG_FILE_MAX, file);
+	fclose(file);
+	return buffer;
+}
+
+static uint8_t render(struct BenchCase* c, uint32_t sample_rate, double duration,
+						struct BenchResult* result) {
+
+	uint8_t is_mus = (strlen(c->name) > 4) && !strcasecmp(c->name + strlen(c->name) - 4, ".mus");
+
+	if (loadSidFile(is_mus, c->data, c->size, sample_rate, (char*)c->name, 0, 0, 0)) {
+		return 0;
+	}
+	playTune(-1, 0, 0);
+
+	uint32_t total = (uint32_t)(duration * getSampleRate());
+
+	uint32_t last_cycles = sysCycles();
+	double start = sysTimeSecs();
+
+	result->samples = 0;
+	result->cycles = 0;
+	while (result->samples < total) {
+		int32_t n = computeAudioSamples();
+		if (n <= 0) break;
+		result->samples += n;
+
+		// the per call delta is still correct after a wrap of the counter
+		uint32_t now = sysCycles();
+		result->cycles += (uint32_t)(now - last_cycles);
+		last_cycles = now;
+	}
+	result->secs = sysTimeSecs() - start;
+	return 1;
+}
+
+static const char* getPathDesc() {
+	if (countSIDs() == 1) return "single";
+	return FileLoader::isExtendedSidFile() ? "stripped" : "multi";
+}
+
+static double percent(double part, double total) {
+	return total > 0 ? 100.0 * part / total : 0;
+}
+
+static void showHelp(char *argv[]) {
+	fprintf(stderr, "Usage: %s [Options] [song files]\n", argv[0]);
+	fprintf(stderr, "Options: \n");
+	fprintf(stderr, " -d, --duration : seconds to render per song (default: %d)\n", DEFAULT_DURATION);
+	fprintf(stderr, " -r, --rate     : sample rate in Hz (default: %d)\n", DEFAULT_SAMPLE_RATE);
+	fprintf(stderr, " -s, --no-synth : skip the synthetic stress cases\n");
+	fprintf(stderr, " -c, --csv      : machine readable output\n");
+	fprintf(stderr, " -x, --per-cycle: use cycle-by-cycle instead of event driven clocking\n");
+	fprintf(stderr, " -h, --help     : show this help message\n");
+	exit(1);
+}
+
+int main(int argc, char *argv[]) {
+	uint32_t sample_rate = DEFAULT_SAMPLE_RATE;
+	double duration = DEFAULT_DURATION;
+	uint8_t synthetic = 1;
+	uint8_t csv = 0;
+
+	struct BenchCase* cases = (struct BenchCase*)calloc(argc + 3, sizeof(struct BenchCase));
+	int count = 0;
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+		if ((!strcmp(a, "-d") || !strcmp(a, "--duration")) && (i + 1 < argc)) {
+			duration = atof(argv[++i]);
+		} else if ((!strcmp(a, "-r") || !strcmp(a, "--rate")) && (i + 1 < argc)) {
+			sample_rate = atoi(argv[++i]);
+		} else if (!strcmp(a, "-s") || !strcmp(a, "--no-synth")) {
+			synthetic = 0;
+		} else if (!strcmp(a, "-c") || !strcmp(a, "--csv")) {
+			csv = 1;
+		} else if (!strcmp(a, "-x") || !strcmp(a, "--per-cycle")) {
+			Core::setEventScheduler(0);
+		} else if (a[0] == '-') {
+			showHelp(argv);
+		} else {
+			cases[count].name = a;
+			cases[count].data = loadBuffer(a, &cases[count].size);
+			if (cases[count].data) count++;
+		}
+	}
+	if (synthetic) addSyntheticCases(cases, &count);
+
+	if (!count || (duration <= 0) || !sample_rate) showHelp(argv);
+
+	if (csv) {
+		printf("song,path,sids,cycles,samples,secs,cycles_per_sec,samples_per_sec,realtime_factor,"
+				"sys_pct,sid_clock_pct,synth_pct,other_pct\n");
+	} else {
+		printf("%-40s %-8s %4s %9s %9s %8s %6s %6s %6s %6s\n", "song", "path", "SIDs",
+				"Mcycles/s", "ksmpl/s", "realtime", "sys%", "clock%", "synth%", "other%");
+	}
+
+	struct BenchResult sum;
+	memset(&sum, 0, sizeof(sum));
+
+	for (int i= 0; i<count; i++) {
+		struct BenchCase* c = &cases[i];
+
+		// 1st run: throughput
+		struct BenchResult r;
+		if (!render(c, sample_rate, duration, &r)) {
+			fprintf(stderr, "error: cannot load song: %s\n", c->name);
+			continue;
+		}
+		uint32_t clock_rate = sysGetClockRate(envIsNTSC());
+		double realtime = r.secs > 0 ? ((double)r.cycles / clock_rate) / r.secs : 0;
+
+		sum.cycles += r.cycles;
+		sum.samples += r.samples;
+		sum.secs += r.secs;
+
+		// 2nd run: cost split
+		struct PerfStats p;
+		struct BenchResult rp;
+		memset(&p, 0, sizeof(p));
+		Core::setPerfStats(&p);
+		render(c, sample_rate, duration, &rp);
+		Core::setPerfStats(0);
+
+		double sys = percent(p.sys_secs - p.sid_clock_secs, rp.secs);
+		double clock = percent(p.sid_clock_secs, rp.secs);
+		double synth = percent(p.synth_secs, rp.secs);
+		double other = 100.0 - sys - clock - synth;
+
+		const char* name = c->name;
+		if (!csv && (strlen(name) > 40)) name += strlen(name) - 40;
+
+		if (csv) {
+			printf("\"%s\",%s,%d,%llu,%u,%.4f,%.0f,%.0f,%.2f,%.1f,%.1f,%.1f,%.1f\n", name,
+					getPathDesc(), countSIDs(), (unsigned long long)r.cycles, r.samples, r.secs,
+					r.cycles / r.secs, r.samples / r.secs, realtime, sys, clock, synth, other);
+		} else {
+			printf("%-40s %-8s %4d %9.2f %9.1f %7.1fx %6.1f %6.1f %6.1f %6.1f\n", name,
+					getPathDesc(), countSIDs(), r.cycles / r.secs / 1e6, r.samples / r.secs / 1e3,
+					realtime, sys, clock, synth, other);
+		}
+		fflush(stdout);
+	}
+
+	if (!csv && (sum.secs > 0)) {
+		printf("\ntotal: %.2f Mcycles/s, %.1f ksamples/s (%.2f secs)\n",
+				sum.cycles / sum.secs / 1e6, sum.samples / sum.secs / 1e3, sum.secs);
+	}
+	return 0;
+}
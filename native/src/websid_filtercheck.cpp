@@ -0,0 +1,171 @@
+/*
+* Deviation check: renders each of the specified songs twice, once using the
+* regular "double" based filter implementation and once using the integer
+* (fixed-point) one (see Filter::setFixedPoint), and reports how much the two
+* outputs differ and how the time spent in the SID::synthSamples*() functions
+* (see Core::setPerfStats) compares.
+*
+* The signal-to-noise ratio is calculated using the "double" output as the
+* reference signal and the difference between both outputs as the noise.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>	// strcasecmp
+#include <math.h>
+
+#include <vector>
+
+#include "websid_api.h"
+
+#include "core.h"
+
+#define SONG_FILE_MAX 0x10000 + 0x7c + 0x200	// 64k plus header plus some slack
+#define DEFAULT_SAMPLE_RATE 44100
+#define DEFAULT_DURATION 20
+
+struct CheckResult {
+	std::vector<int16_t> out;	// interleaved stereo
+	double synth_secs;
+};
+
+
+static uint8_t* loadBuffer(const char* filename, uint32_t* size) {
+	FILE* file = fopen(filename, "rb");
+	if (file == NULL) {
+		fprintf(stderr, "error: file not found: %s\n", filename);
+		return 0;
+	}
+	uint8_t* buffer = (uint8_t*)malloc(SONG_FILE_MAX);
+	*size = fread(buffer, 1, SONG_FILE_MAX, file);
+	fclose(file);
+	return buffer;
+}
+
+static uint8_t render(const char* name, uint8_t* data, uint32_t size, uint32_t sample_rate,
+						double duration, uint8_t fixed_point, struct CheckResult* result) {
+
+	uint8_t is_mus = (strlen(name) > 4) && !strcasecmp(name + strlen(name) - 4, ".mus");
+
+	setFixedPointFilter(fixed_point);	// must be set before the song is started
+
+	if (loadSidFile(is_mus, data, size, sample_rate, (char*)name, 0, 0, 0)) {
+		return 0;
+	}
+	playTune(-1, 0, 0);
+
+	uint32_t total = (uint32_t)(duration * getSampleRate());
+
+	struct PerfStats p;
+	memset(&p, 0, sizeof(p));
+	Core::setPerfStats(&p);
+
+	result->out.clear();
+	result->out.reserve(total * 2);
+
+	uint32_t samples = 0;
+	while (samples < total) {
+		int32_t n = computeAudioSamples();
+		if (n <= 0) break;
+
+		int16_t* buf = (int16_t*)getSoundBuffer();
+		result->out.insert(result->out.end(), buf, buf + n * 2);
+		samples += n;
+	}
+	Core::setPerfStats(0);
+
+	result->synth_secs = p.synth_secs;
+	return 1;
+}
+
+static void showHelp(char *argv[]) {
+	fprintf(stderr, "Usage: %s [Options] song files\n", argv[0]);
+	fprintf(stderr, "Options: \n");
+	fprintf(stderr, " -d, --duration : seconds to render per song (default: %d)\n", DEFAULT_DURATION);
+	fprintf(stderr, " -r, --rate     : sample rate in Hz (default: %d)\n", DEFAULT_SAMPLE_RATE);
+	fprintf(stderr, " -m, --min-snr  : fail (exit code 2) if the SNR of any song is below the specified dB\n");
+	fprintf(stderr, " -h, --help     : show this help message\n");
+	exit(1);
+}
+
+int main(int argc, char *argv[]) {
+	uint32_t sample_rate = DEFAULT_SAMPLE_RATE;
+	double duration = DEFAULT_DURATION;
+	double min_snr = -1;
+
+	std::vector<const char*> songs;
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+		if ((!strcmp(a, "-d") || !strcmp(a, "--duration")) && (i + 1 < argc)) {
+			duration = atof(argv[++i]);
+		} else if ((!strcmp(a, "-r") || !strcmp(a, "--rate")) && (i + 1 < argc)) {
+			sample_rate = atoi(argv[++i]);
+		} else if ((!strcmp(a, "-m") || !strcmp(a, "--min-snr")) && (i + 1 < argc)) {
+			min_snr = atof(argv[++i]);
+		} else if (a[0] == '-') {
+			showHelp(argv);
+		} else {
+			songs.push_back(a);
+		}
+	}
+	if (songs.empty() || (duration <= 0) || !sample_rate) showHelp(argv);
+
+	printf("%-40s %5s %10s %10s %8s %8s\n", "song", "model", "peak diff", "rms diff", "SNR dB", "speedup");
+
+	int failed = 0;
+
+	for (size_t i= 0; i<songs.size(); i++) {
+		const char* name = songs[i];
+
+		uint32_t size;
+		uint8_t* data = loadBuffer(name, &size);
+		if (!data) continue;
+
+		struct CheckResult ref, fix;
+		if (!render(name, data, size, sample_rate, duration, 0, &ref) ||
+				!render(name, data, size, sample_rate, duration, 1, &fix)) {
+			fprintf(stderr, "error: cannot load song: %s\n", name);
+			free(data);
+			continue;
+		}
+		free(data);
+
+		size_t n = ref.out.size() < fix.out.size() ? ref.out.size() : fix.out.size();
+
+		int32_t peak = 0;
+		double signal = 0, noise = 0;
+		for (size_t j= 0; j<n; j++) {
+			int32_t d = fix.out[j] - ref.out[j];
+			if (abs(d) > peak) peak = abs(d);
+
+			signal += (double)ref.out[j] * ref.out[j];
+			noise += (double)d * d;
+		}
+		double rms = n ? sqrt(noise / n) : 0;
+		double snr = noise > 0 ? 10.0 * log10(signal / noise) : INFINITY;
+		double speedup = fix.synth_secs > 0 ? ref.synth_secs / fix.synth_secs : 0;
+
+		if ((min_snr >= 0) && (snr < min_snr)) failed++;
+
+		if (strlen(name) > 40) name += strlen(name) - 40;
+
+		printf("%-40s %5s %10d %10.3f %8.1f %7.2fx\n", name, envIsSID6581() ? "6581" : "8580",
+				peak, rms, snr, speedup);
+		fflush(stdout);
+	}
+	setFixedPointFilter(0);
+
+	if (failed) {
+		fprintf(stderr, "error: %d song(s) below the minimum SNR of %.1f dB\n", failed, min_snr);
+		return 2;
+	}
+	return 0;
+}
@@ -0,0 +1,341 @@
+/*
+* Headless command line renderer: converts a .sid/.mus file into raw PCM or
+* WAV data - as fast as the emulator can produce it (i.e. no realtime pacing).
+*
+* This uses the same API that the browser uses (see sidplayer.cpp), i.e. the
+* output should be identical to what WebSid plays in the browser.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>	// strcasecmp
+
+#include <algorithm>
+#include <vector>
+
+#include "websid_api.h"
+#include "wav_file.h"
+extern "C" {
+#include "cpu.h"
+}
+
+#define SONG_FILE_MAX 0x10000 + 0x7c + 0x200	// 64k plus header plus some slack
+
+#define DEFAULT_SAMPLE_RATE 44100
+#define DEFAULT_DURATION 180
+#define SILENCE_MAX 600		// secs
+#define PROFILE_HOT_SPOTS 64	// addresses listed in the profile report
+
+
+static void showHelp(char *argv[]) {
+	fprintf(stderr, "Usage: %s <song filename> [Options]\n", argv[0]);
+	fprintf(stderr, "Options: \n");
+	fprintf(stderr, " -o, --output   : output file (default: stdout)\n");
+	fprintf(stderr, " -f, --format   : 'wav' or 'raw' (default: derived from output file name)\n");
+	fprintf(stderr, " -t, --track    : index of the track to play (if more than 1 is available)\n");
+	fprintf(stderr, " -r, --rate     : sample rate in Hz (default: %d, max: 48000)\n", DEFAULT_SAMPLE_RATE);
+	fprintf(stderr, " -d, --duration : seconds to render (default: %d)\n", DEFAULT_DURATION);
+	fprintf(stderr, " -s, --start    : start rendering at the specified second\n");
+	fprintf(stderr, " -S, --skip-silence : start rendering when the song first becomes audible\n");
+	fprintf(stderr, " -m, --model    : force SID model '6581' or '8580'\n");
+	fprintf(stderr, " -n, --ntsc     : force NTSC mode\n");
+	fprintf(stderr, " -p, --pal      : force PAL mode\n");
+	fprintf(stderr, " -q, --quiet    : do not print song info\n");
+	fprintf(stderr, " -P, --profile  : write a CPU hot-spot report to the file (binary dump if it ends with .bin)\n");
+	fprintf(stderr, " -w, --waveforms: load \"combined waveform\" tables from the file (see websid-wftables)\n");
+	fprintf(stderr, " -h, --help     : show this help message\n\n");
+	fprintf(stderr, "Raw output is 16-bit signed little endian stereo PCM.\n");
+	exit(1);
+}
+
+struct RenderOptions {
+	const char* filename;
+	const char* output;
+	uint8_t is_wav;
+	int32_t track;
+	uint32_t sample_rate;
+	double duration;
+	double start;
+	uint8_t skip_silence;
+	int8_t model;		// -1 means "use setting from file"
+	int8_t ntsc;		// -1 means "use setting from file"
+	uint8_t quiet;
+	const char* profile;
+	const char* waveforms;
+};
+
+static const char* nextArg(int argc, char *argv[], int *i) {
+	if (++(*i) >= argc) {
+		fprintf(stderr, "error: missing value for %s\n", argv[(*i) - 1]);
+		exit(1);
+	}
+	return argv[*i];
+}
+
+static uint8_t endsWith(const char* str, const char* suffix) {
+	size_t l = strlen(str);
+	size_t s = strlen(suffix);
+	return (l >= s) && !strcasecmp(str + l - s, suffix);
+}
+
+static void handleArgs(int argc, char *argv[], struct RenderOptions* opt) {
+	int8_t format = -1;
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+
+		if (!opt->filename && (a[0] != '-')) {
+			opt->filename = a;
+		} else if (!strcmp(a, "-o") || !strcmp(a, "--output")) {
+			opt->output = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-f") || !strcmp(a, "--format")) {
+			const char* f = nextArg(argc, argv, &i);
+			if (!strcmp(f, "wav")) {
+				format = 1;
+			} else if (!strcmp(f, "raw")) {
+				format = 0;
+			} else {
+				fprintf(stderr, "error: unsupported format: %s\n", f);
+				exit(1);
+			}
+		} else if (!strcmp(a, "-t") || !strcmp(a, "--track")) {
+			opt->track = atoi(nextArg(argc, argv, &i)) - 1;
+		} else if (!strcmp(a, "-r") || !strcmp(a, "--rate")) {
+			opt->sample_rate = atoi(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-d") || !strcmp(a, "--duration")) {
+			opt->duration = atof(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-s") || !strcmp(a, "--start")) {
+			opt->start = atof(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-S") || !strcmp(a, "--skip-silence")) {
+			opt->skip_silence = 1;
+		} else if (!strcmp(a, "-m") || !strcmp(a, "--model")) {
+			const char* m = nextArg(argc, argv, &i);
+			if (!strcmp(m, "6581")) {
+				opt->model = 1;
+			} else if (!strcmp(m, "8580")) {
+				opt->model = 0;
+			} else {
+				fprintf(stderr, "error: unsupported SID model: %s\n", m);
+				exit(1);
+			}
+		} else if (!strcmp(a, "-n") || !strcmp(a, "--ntsc")) {
+			opt->ntsc = 1;
+		} else if (!strcmp(a, "-p") || !strcmp(a, "--pal")) {
+			opt->ntsc = 0;
+		} else if (!strcmp(a, "-q") || !strcmp(a, "--quiet")) {
+			opt->quiet = 1;
+		} else if (!strcmp(a, "-P") || !strcmp(a, "--profile")) {
+			opt->profile = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-w") || !strcmp(a, "--waveforms")) {
+			opt->waveforms = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-h") || !strcmp(a, "--help")) {
+			showHelp(argv);
+		} else {
+			fprintf(stderr, "warning: invalid parameter: %s\n", a);
+		}
+	}
+
+	if (!opt->filename || (opt->sample_rate == 0) || (opt->duration <= 0)) {
+		showHelp(argv);
+	}
+
+	if (format < 0) {
+		opt->is_wav = opt->output && endsWith(opt->output, ".wav");
+	} else {
+		opt->is_wav = format;
+	}
+}
+
+static uint8_t* loadBuffer(const char* filename, uint32_t* size) {
+	FILE* file = fopen(filename, "rb");
+	if (file == NULL) {
+		fprintf(stderr, "error: file not found: %s\n", filename);
+		return 0;
+	}
+	uint8_t* buffer = (uint8_t*)malloc(SONG_FILE_MAX);
+	*size = fread(buffer, 1, SONG_FILE_MAX, file);
+	fclose(file);
+	return buffer;
+}
+
+// ----------------- rendering -----------------------------------------
+
+static void printInfo(char** info) {
+	fprintf(stderr, "song:      %s\n", info[4]);
+	fprintf(stderr, "author:    %s\n", info[5]);
+	fprintf(stderr, "released:  %s\n", info[6]);
+	fprintf(stderr, "track:     %d/%d\n", *((uint8_t*)info[3]) + 1, *((uint8_t*)info[2]));
+	fprintf(stderr, "SIDs:      %d (%s)\n", countSIDs(), envIsSID6581() ? "6581" : "8580");
+	fprintf(stderr, "video:     %s\n", envIsNTSC() ? "NTSC" : "PAL");
+}
+
+// ----------------- profiling -----------------------------------------
+
+static double percent(uint32_t part, uint64_t total) {
+	return total ? 100.0 * part / total : 0;
+}
+
+static void writeProfileReport(FILE* out, const struct CpuProfile* p) {
+	uint64_t total = 0, count = 0;
+	for (uint32_t i = 0; i < 256; i++) {
+		total += p->op_cycles[i];
+		count += p->op_count[i];
+	}
+	fprintf(out, "cycles:       %llu\n", (unsigned long long)total);
+	fprintf(out, "instructions: %llu\n", (unsigned long long)(count - p->irq_count - p->nmi_count));
+	fprintf(out, "IRQ entries:  %u\n", p->irq_count);
+	fprintf(out, "NMI entries:  %u\n", p->nmi_count);
+	fprintf(out, "VIC stuns:    %u cycles (%.2f%%)\n", p->stun_cycles, percent(p->stun_cycles, total));
+
+	std::vector<uint32_t> idx;
+	for (uint32_t i = 0; i < 0x10000; i++) {
+		if (p->pc_count[i]) idx.push_back(i);
+	}
+	std::stable_sort(idx.begin(), idx.end(), [p](uint32_t a, uint32_t b) {
+		return p->pc_cycles[a] > p->pc_cycles[b];
+	});
+	fprintf(out, "\nhot spots (%u of %u addresses):\n", (uint32_t)std::min((size_t)PROFILE_HOT_SPOTS, idx.size()),
+			(uint32_t)idx.size());
+	fprintf(out, " addr  op      cycles       %%       count  cycles/exec\n");
+	for (size_t i = 0; (i < idx.size()) && (i < PROFILE_HOT_SPOTS); i++) {
+		uint32_t a = idx[i];
+		fprintf(out, " $%04x %02x %11u %7.2f %11u %8.2f\n", a, p->pc_opcode[a], p->pc_cycles[a],
+				percent(p->pc_cycles[a], total), p->pc_count[a], ((double)p->pc_cycles[a]) / p->pc_count[a]);
+	}
+
+	idx.clear();
+	for (uint32_t i = 0; i < 256; i++) {
+		if (p->op_count[i]) idx.push_back(i);
+	}
+	std::stable_sort(idx.begin(), idx.end(), [p](uint32_t a, uint32_t b) {
+		return p->op_cycles[a] > p->op_cycles[b];
+	});
+	fprintf(out, "\nopcodes:\n");
+	fprintf(out, " op       cycles       %%       count\n");
+	for (size_t i = 0; i < idx.size(); i++) {
+		uint32_t o = idx[i];
+		if (o == CPU_PROFILE_IRQ_OP) {
+			fprintf(out, " IRQ");
+		} else if (o == CPU_PROFILE_NMI_OP) {
+			fprintf(out, " NMI");
+		} else {
+			fprintf(out, " %02x ", o);
+		}
+		fprintf(out, "%11u %7.2f %11u\n", p->op_cycles[o], percent(p->op_cycles[o], total), p->op_count[o]);
+	}
+}
+
+static uint8_t writeProfile(const char* filename) {
+	const struct CpuProfile* p = cpuGetProfile();
+
+	FILE* out = fopen(filename, "wb");
+	if (!out) {
+		fprintf(stderr, "error: cannot create profile file: %s\n", filename);
+		return 0;
+	}
+	if (endsWith(filename, ".bin")) {
+		fwrite(p, sizeof(struct CpuProfile), 1, out);	// layout see cpu.h (host byte order)
+	} else {
+		writeProfileReport(out, p);
+	}
+	uint8_t ok = !ferror(out);
+	fclose(out);
+	return ok;
+}
+
+int main(int argc, char *argv[]) {
+	struct RenderOptions opt;
+	memset(&opt, 0, sizeof(opt));
+	opt.track = -1;		// use the song's default
+	opt.sample_rate = DEFAULT_SAMPLE_RATE;
+	opt.duration = DEFAULT_DURATION;
+	opt.model = -1;
+	opt.ntsc = -1;
+
+	handleArgs(argc, argv, &opt);
+
+	if (opt.profile) cpuEnableProfile(1);	// includes the song's INIT
+
+	uint32_t size;
+	if (opt.waveforms) {
+		uint8_t* tables = loadBuffer(opt.waveforms, &size);
+		if (!tables || loadCombinedWaveforms(tables, size)) {
+			fprintf(stderr, "error: cannot load combined waveforms: %s\n", opt.waveforms);
+			return 1;
+		}
+		free(tables);
+	}
+
+	uint8_t* buffer = loadBuffer(opt.filename, &size);
+	if (!buffer) return 1;
+
+	uint8_t is_mus = endsWith(opt.filename, ".mus");
+
+	if (loadSidFile(is_mus, buffer, size, opt.sample_rate, (char*)opt.filename, 0, 0, 0)) {
+		fprintf(stderr, "error: cannot load song: %s\n", opt.filename);
+		return 1;
+	}
+
+	// overrides must be applied before the tune is started
+	if (opt.ntsc >= 0) envSetNTSC(opt.ntsc);
+	if (opt.model >= 0) envSetSID6581(opt.model);
+
+	playTune(opt.track, 0, 0);
+
+	if (isInitTimeout()) fprintf(stderr, "warning: INIT routine of the song did not complete\n");
+
+	if (!opt.quiet) printInfo(getMusicInfo());
+
+	uint32_t skipped = 0;	// millis
+	if (opt.skip_silence) skipped += skipSilence(SILENCE_MAX * 1000);
+	if (opt.start > 0) skipped += warpTo((uint32_t)(opt.start * 1000));
+
+	if (!opt.quiet && skipped) fprintf(stderr, "skipped:   %.2f secs\n", skipped / 1000.0);
+
+	FILE* out = stdout;
+	if (opt.output && strcmp(opt.output, "-")) {
+		out = fopen(opt.output, "wb");
+		if (!out) {
+			fprintf(stderr, "error: cannot create output file: %s\n", opt.output);
+			return 1;
+		}
+	}
+
+	uint32_t sample_rate = getSampleRate();	// the emulator may have limited the requested rate
+	uint32_t total = (uint32_t)(opt.duration * sample_rate);
+
+	if (opt.is_wav) wavWriteHeader(out, sample_rate, total * CHANNELS * sizeof(int16_t));
+
+	uint32_t rendered = 0;
+	while (rendered < total) {
+		int32_t n = computeAudioSamples();
+		if (n <= 0) break;		// end of track (or not ready)
+
+		if (rendered + n > total) n = total - rendered;
+
+		wavWriteSamples(out, (int16_t*)getSoundBuffer(), n);
+		rendered += n;
+	}
+
+	if (opt.is_wav && (rendered < total)) {
+		// song ended early: fix the header (not possible when writing to a pipe)
+		if (!fseek(out, 0, SEEK_SET)) {
+			wavWriteHeader(out, sample_rate, rendered * CHANNELS * sizeof(int16_t));
+		}
+	}
+	if (out != stdout) fclose(out);
+	free(buffer);
+
+	if (opt.profile && !writeProfile(opt.profile)) return 1;
+
+	if (!opt.quiet) fprintf(stderr, "rendered:  %u samples (%.2f secs)\n", rendered, ((double)rendered) / sample_rate);
+	return 0;
+}
@@ -0,0 +1,271 @@
+/*
+* Test runner: runs Wolfgang Lorenz's C64 test-suite (see htdocs_test/tests/cpu)
+* natively using all the available CPU cores, i.e. without the need for the
+* browser based test page.
+*
+* The runner must be linked against a library that has been compiled with
+* -DTEST (see "websid-test" target in the Makefile): each test is then run
+* to completion by the TestFileLoader directly from within ctxLoadSidFile().
+* A test has passed if it reports "OK" and then tries to load the next test
+* of the suite (the loading itself is not performed, i.e. each test is run
+* separately). Failing tests typically stop after printing their findings and
+* those that wait for a key press are aborted (see TEST_CYCLE_LIMIT in core.cpp).
+*
+* The results are reported in alphabetical order once all the tests are done.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core.h"
+#include "context.h"
+extern "C" {
+#include "system.h"
+}
+
+#define TEST_FILE_MAX 0x10000 + 2		// 64k plus load address
+#define DEFAULT_TEST_FOLDER "../htdocs_test/tests/cpu"
+
+// path that TestFileLoader expects for the test files
+#define TEST_PATH "/websid_test/tests/cpu/"
+
+
+struct TestOptions {
+	const char* folder;
+	const char* expected;		// file that lists the known failures
+	uint32_t threads;
+	uint8_t cycle_by_cycle;
+	uint8_t verbose;
+};
+
+struct TestResult {
+	std::string name;
+	std::string output;			// what the test printed to the screen
+	std::string next;			// test that it tried to load next
+	uint32_t cycles;
+	double secs;
+	uint8_t passed;
+};
+
+static void showHelp(char *argv[]) {
+	fprintf(stderr, "Usage: %s [Options] [test folder]\n", argv[0]);
+	fprintf(stderr, "Options: \n");
+	fprintf(stderr, " -j, --jobs     : number of worker threads (default: number of cores)\n");
+	fprintf(stderr, " -x, --expect   : file that lists the tests that are known to fail (one per line)\n");
+	fprintf(stderr, " -c, --cycles   : use cycle-by-cycle emulation instead of the event scheduler\n");
+	fprintf(stderr, " -v, --verbose  : show the output of failed tests\n");
+	fprintf(stderr, " -h, --help     : show this help message\n\n");
+	fprintf(stderr, "The test folder defaults to %s\n", DEFAULT_TEST_FOLDER);
+	exit(1);
+}
+
+static const char* nextArg(int argc, char *argv[], int *i) {
+	if (++(*i) >= argc) {
+		fprintf(stderr, "error: missing value for %s\n", argv[(*i) - 1]);
+		exit(1);
+	}
+	return argv[*i];
+}
+
+static void readTestNames(const char* folder, std::vector<std::string>& names) {
+	DIR* dir = opendir(folder);
+	if (!dir) {
+		fprintf(stderr, "error: cannot read folder: %s\n", folder);
+		exit(1);
+	}
+	struct dirent* e;
+	while ((e = readdir(dir))) {
+		// the test programs have no file extension (skips e.g. "all.txt")
+		if (!strchr(e->d_name, '.')) names.push_back(e->d_name);
+	}
+	closedir(dir);
+
+	std::sort(names.begin(), names.end());
+}
+
+static void readExpectedFailures(const char* file, std::set<std::string>& expected) {
+	FILE* f = fopen(file, "r");
+	if (!f) {
+		fprintf(stderr, "error: file not found: %s\n", file);
+		exit(1);
+	}
+	char line[256];
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, " \t\r\n")] = 0;
+		if (line[0] && (line[0] != '#')) expected.insert(line);
+	}
+	fclose(f);
+}
+
+// ----------------- hooks used by the emulator (see cpu_operations.inc) ------------
+
+static thread_local TestResult* _current = 0;
+
+extern "C" void testOutputPETSCII(uint8_t c) {
+	if (!_current) return;
+
+	if (c == 13) {
+		_current->output += '\n';
+	} else if ((c >= 32) && (c < 127)) {
+		_current->output += (char)c;	// PETSCII uppercase maps to ASCII
+	}
+	// ignore cursor movement, colors, etc
+}
+
+extern "C" void testLoadFile(const char* filename) {
+	if (_current) _current->next = filename;
+}
+
+// ----------------- test execution -----------------------------------------
+
+static void runTest(EmulatorContext* ctx, const TestOptions* opt, uint8_t* buffer, TestResult* r) {
+	std::string file = std::string(opt->folder) + "/" + r->name;
+	FILE* f = fopen(file.c_str(), "rb");
+	if (!f) {
+		r->output = "cannot read file";
+		return;
+	}
+	uint32_t size = fread(buffer, 1, TEST_FILE_MAX, f);
+	fclose(f);
+
+	std::string path = TEST_PATH + r->name;
+
+	_current = r;
+	double start = sysTimeSecs();
+	ctxLoadSidFile(ctx, 0, buffer, size, 44100, (char*)path.c_str(), 0, 0, 0);	// runs the test
+	r->secs = sysTimeSecs() - start;
+	r->cycles = sysCycles();
+	_current = 0;
+
+	r->passed = (r->output.find("- OK") != std::string::npos) && !r->next.empty();
+}
+
+static void runWorker(const TestOptions* opt, std::vector<TestResult>* results, std::atomic<uint32_t>* next) {
+	EmulatorContext* ctx = ctxCreate();
+	uint8_t* buffer = (uint8_t*)malloc(TEST_FILE_MAX);
+
+	Core::setEventScheduler(!opt->cycle_by_cycle);	// setting is per thread
+
+	// tests are run in alphabetical order, i.e. the expensive ones are spread
+	// evenly across the run
+	uint32_t idx;
+	while ((idx = (*next)++) < results->size()) {
+		runTest(ctx, opt, buffer, &(*results)[idx]);
+	}
+	free(buffer);
+	ctxDestroy(ctx);
+}
+
+static void printOutput(const std::string& output) {
+	size_t p = 0;
+	while (p < output.size()) {
+		size_t e = output.find('\n', p);
+		if (e == std::string::npos) e = output.size();
+		if (e > p) printf("        %s\n", output.substr(p, e - p).c_str());
+		p = e + 1;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	TestOptions opt;
+	memset(&opt, 0, sizeof(opt));
+	opt.folder = DEFAULT_TEST_FOLDER;
+	opt.threads = std::thread::hardware_concurrency();
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+
+		if (a[0] != '-') {
+			opt.folder = a;
+		} else if (!strcmp(a, "-j") || !strcmp(a, "--jobs")) {
+			opt.threads = atoi(nextArg(argc, argv, &i));
+		} else if (!strcmp(a, "-x") || !strcmp(a, "--expect")) {
+			opt.expected = nextArg(argc, argv, &i);
+		} else if (!strcmp(a, "-c") || !strcmp(a, "--cycles")) {
+			opt.cycle_by_cycle = 1;
+		} else if (!strcmp(a, "-v") || !strcmp(a, "--verbose")) {
+			opt.verbose = 1;
+		} else {
+			showHelp(argv);
+		}
+	}
+
+	std::set<std::string> expected;
+	if (opt.expected) readExpectedFailures(opt.expected, expected);
+
+	std::vector<std::string> names;
+	readTestNames(opt.folder, names);
+	if (names.empty()) {
+		fprintf(stderr, "error: no tests found in %s\n", opt.folder);
+		return 1;
+	}
+
+	std::vector<TestResult> results(names.size());
+	for (size_t i = 0; i < names.size(); i++) {
+		results[i].name = names[i];
+		results[i].cycles = 0;
+		results[i].secs = 0;
+		results[i].passed = 0;
+	}
+
+	if (!opt.threads) opt.threads = 1;
+	if (opt.threads > results.size()) opt.threads = results.size();
+
+	std::atomic<uint32_t> next(0);
+	std::vector<std::thread> workers;
+
+	double start = sysTimeSecs();
+	for (uint32_t i = 0; i < opt.threads; i++) {
+		workers.push_back(std::thread(runWorker, &opt, &results, &next));
+	}
+	for (uint32_t i = 0; i < opt.threads; i++) {
+		workers[i].join();
+	}
+	double secs = sysTimeSecs() - start;
+
+	uint32_t passed = 0, known = 0, failed = 0, fixed = 0;
+	uint64_t cycles = 0;
+
+	for (size_t i = 0; i < results.size(); i++) {
+		const TestResult* r = &results[i];
+		uint8_t is_expected = expected.count(r->name) > 0;
+
+		const char* status;
+		if (r->passed) {
+			passed++;
+			status = is_expected ? "FIXED" : "PASS";	// the list should be updated
+			if (is_expected) fixed++;
+		} else if (is_expected) {
+			known++;
+			status = "KNOWN";
+		} else {
+			failed++;
+			status = "FAIL";
+		}
+		cycles += r->cycles;
+
+		printf("%-5s %-10s %10u cycles %8.3f secs\n", status, r->name.c_str(), r->cycles, r->secs);
+
+		if (opt.verbose && !r->passed) printOutput(r->output);
+	}
+	printf("%u tests: %u passed, %u failed (%u known failures, %u fixed) - %llu cycles on %u threads in %.2f secs\n",
+			(uint32_t)results.size(), passed, known + failed, known, fixed, (unsigned long long)cycles,
+			opt.threads, secs);
+
+	return failed ? 2 : 0;
+}
@@ -0,0 +1,144 @@
+/*
+* Generator for the built-in "combined waveform" lookup tables (see src/combinedwf.h).
+*
+* The tables used to be calculated by the emulator at startup (4 x 4096 entries
+* with 12 x 12 pow() calls each). They are now calculated once by this tool and the
+* resulting source file is part of the repository. Use "make wftables" in the
+* "native" folder to regenerate it after changing the below params.
+*
+* The tool can also write the tables in the binary format that is understood by
+* loadCombinedWaveforms() (e.g. as a starting point for measured per-chip tables).
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define WF_TABLE_SIZE 4096
+
+struct TableParams {
+	const char* name;
+	double bitmul;
+	double bitstrength;
+	double threshold;
+	const char* comment;
+};
+
+// same order as in the binary file format (see loadCombinedWaveforms)
+static const TableParams TABLES[] = {
+	{ "TriSaw_8580",		0.8, 2.4, 0.64, 0 },
+	{ "PulseSaw_8580",		1.4, 1.9, 0.68, 0 },
+	// far from "correct" but at least a bit better than Hermit's use of PulseSaw_8580 (see Last_Ninja)
+	{ "PulseTri_8580",		0.8, 1.5, 0.38, "improved settings are welcome!" },
+	{ "PulseTriSaw_8580",	0.8, 2.5, 0.64, 0 },
+};
+#define TABLE_COUNT (sizeof(TABLES) / sizeof(TABLES[0]))
+
+
+static void createCombinedWF(uint16_t* wfarray, double bitmul, double bitstrength, double threshold) {
+	// Hermit: "I found out how the combined waveform works (neighboring bits affect each other recursively)"
+	for (uint16_t i = 0; i < WF_TABLE_SIZE; i++) {
+		double wf = 0; //neighbour-bit strength and DAC MOSFET threshold is approximately set by ears'n'trials
+		for (uint8_t j = 0; j < 12; j++) {
+			double bitlevel = 0;
+			for (uint8_t k = 0; k < 12; k++) {
+				bitlevel += (bitmul / pow(bitstrength, abs(k - j))) * (((i >> k) & 1) - 0.5);
+			}
+			wf += (bitlevel >= threshold) ? pow(2.0, (double)j) : 0;
+		}
+		wfarray[i] = (uint16_t)(wf * 12);	// max 0xfff * 12, i.e. exact in 16-bits
+	}
+}
+
+static void writeSource(FILE* out, uint16_t tables[][WF_TABLE_SIZE]) {
+	fprintf(out, "/*\n");
+	fprintf(out, "* Hermit's precalculated \"combined waveforms\" (see WaveGenerator::combinedWF).\n");
+	fprintf(out, "*\n");
+	fprintf(out, "* Caution: This file is generated by native/src/websid_wftables.cpp - do not edit!\n");
+	fprintf(out, "*/\n");
+	fprintf(out, "#ifndef WEBSID_COMBINEDWF_H\n");
+	fprintf(out, "#define WEBSID_COMBINEDWF_H\n\n");
+	fprintf(out, "#include <stdint.h>\n\n");
+	fprintf(out, "#define WF_TABLE_SIZE %d\n\n", WF_TABLE_SIZE);
+	fprintf(out, "struct CombinedWaveforms {\n");
+	for (size_t t= 0; t<TABLE_COUNT; t++) {
+		fprintf(out, "\tuint16_t %s[WF_TABLE_SIZE];\n", TABLES[t].name);
+	}
+	fprintf(out, "};\n\n");
+	fprintf(out, "static const struct CombinedWaveforms DEFAULT_COMBINED_WAVEFORMS = {\n");
+
+	for (size_t t= 0; t<TABLE_COUNT; t++) {
+		const TableParams* p = &TABLES[t];
+		fprintf(out, "\t// %s: bitmul %g, bitstrength %g, threshold %g%s%s\n", p->name,
+				p->bitmul, p->bitstrength, p->threshold, p->comment ? " - " : "", p->comment ? p->comment : "");
+		fprintf(out, "\t{");
+		for (int i= 0; i<WF_TABLE_SIZE; i++) {
+			if (!(i % 16)) fprintf(out, "\n\t\t");
+			fprintf(out, "%d,", tables[t][i]);
+		}
+		fprintf(out, "\n\t},\n");
+	}
+	fprintf(out, "};\n\n");
+	fprintf(out, "#endif\n");
+}
+
+static void writeBinary(FILE* out, uint16_t tables[][WF_TABLE_SIZE]) {
+	// little endian
+	for (size_t t= 0; t<TABLE_COUNT; t++) {
+		for (int i= 0; i<WF_TABLE_SIZE; i++) {
+			fputc(tables[t][i] & 0xff, out);
+			fputc(tables[t][i] >> 8, out);
+		}
+	}
+}
+
+static void showHelp(char *argv[]) {
+	fprintf(stderr, "Usage: %s [Options]\n", argv[0]);
+	fprintf(stderr, "Options: \n");
+	fprintf(stderr, " -o, --output   : output file (default: stdout)\n");
+	fprintf(stderr, " -b, --binary   : write the binary format used by loadCombinedWaveforms() instead of C source\n");
+	fprintf(stderr, " -h, --help     : show this help message\n");
+	exit(1);
+}
+
+int main(int argc, char *argv[]) {
+	const char* out_file = 0;
+	uint8_t binary = 0;
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+		if ((!strcmp(a, "-o") || !strcmp(a, "--output")) && (i + 1 < argc)) {
+			out_file = argv[++i];
+		} else if (!strcmp(a, "-b") || !strcmp(a, "--binary")) {
+			binary = 1;
+		} else {
+			showHelp(argv);
+		}
+	}
+
+	static uint16_t tables[TABLE_COUNT][WF_TABLE_SIZE];
+	for (size_t t= 0; t<TABLE_COUNT; t++) {
+		createCombinedWF(tables[t], TABLES[t].bitmul, TABLES[t].bitstrength, TABLES[t].threshold);
+	}
+
+	FILE* out = out_file ? fopen(out_file, binary ? "wb" : "w") : stdout;
+	if (!out) {
+		fprintf(stderr, "error: cannot write file: %s\n", out_file);
+		return 1;
+	}
+	if (binary) {
+		writeBinary(out, tables);
+	} else {
+		writeSource(out, tables);
+	}
+	if (out_file) fclose(out);
+	return 0;
+}
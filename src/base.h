@@ -20,6 +20,23 @@ typedef unsigned int uint32_t;
 
 #define OPT_USE_INLINE_ACCESS
 
+/*
+* All the mutable emulator state is kept in thread local variables, i.e. each
+* thread runs its own separate emulator instance (see context.h). "__thread"
+* is used for plain data since it avoids the access wrappers that C++'s
+* "thread_local" uses - which is needed for objects with constructors. (The
+* emulator's own classes therefore are kept trivially constructible, e.g. see
+* SID::resetAll().) The single threaded WebAssembly build does not need any
+* of this.
+*/
+#ifdef EMSCRIPTEN
+#define THREAD_LOCAL
+#define THREAD_LOCAL_OBJ
+#else
+#define THREAD_LOCAL __thread
+#define THREAD_LOCAL_OBJ thread_local
+#endif
+
 //#define DEBUG
 
 /*
@@ -37,6 +37,8 @@
 #include <string.h>
 
 #include "memory.h"
+#include "system.h"
+#include "cpu.h"
 
 #ifdef DEBUG
 #include <emscripten.h>
@@ -153,6 +155,10 @@ struct Timer {
 		// performance optimitaion
 		uint8_t is_started;		// redundant to respective ctrl reg flag
 
+			// lazy counter (see sleepT())
+		uint8_t is_lazy;		// io_area counter is not updated while just counting down
+		uint32_t counter_ts;	// 1st cycle that is not yet reflected in the io_area counter
+
 	} ts[2];					// timers A & B
 
 	uint8_t delay_INT;			// delayed INTERRUPT signaling (depends on chip model)
@@ -165,11 +171,17 @@ struct Timer {
 	uint8_t	interrupt_mask_match;	// interrupt_status & interrupt_mask
 		// linked timer mode
 	uint8_t	b_is_linked_to_a;
+		// the chip needs no regular clocking before this cycle (see clock())
+	uint32_t wake_ts;
 };
 
-static struct Timer _cia[2];
+static THREAD_LOCAL struct Timer _cia[2];
+
+// first cycle that the timers have not been clocked for yet, i.e. the lazy
+// counters must be counted down up to (excluding) this cycle
+static THREAD_LOCAL uint32_t _clocked_ts = 0;
 
-static uint8_t _is_rsid;		// redundant: to avoid dependency
+static THREAD_LOCAL uint8_t _is_rsid;		// redundant: to avoid dependency
 
 uint8_t ciaNMI() {
 
@@ -255,11 +267,42 @@ uint8_t ciaIRQ() {
 	t->ts[timer_idx].is_started = ctrl_new & 0x1;\
 	memWriteIO(addr, ctrl_new);
 
-// use this whenever "interrupt_status" is updated..
+// use this whenever "interrupt_status" is updated.. (the CPU is notified
+// of the respective IRQ/NMI line)
 #define SYNC_STATUS_CACHE(t, ...) \
 	__VA_ARGS__ \
 	t->interrupt_on = t->interrupt_status & ICR_INTERRUPT_ON; \
-	t->interrupt_mask_match = t->interrupt_status & t->interrupt_mask
+	t->interrupt_mask_match = t->interrupt_status & t->interrupt_mask; \
+	if (t == &(_cia[CIA1])) { \
+		cpuSetIRQLine(IRQ_SRC_CIA, t->interrupt_on); \
+	} else { \
+		cpuSetNMILine(t->interrupt_on); \
+	}
+
+// brings the io_area counter of a lazy timer up to date (see sleepT())
+static void syncCounter(struct Timer* t, uint8_t timer_idx) {
+	struct TimerState *ts = &t->ts[timer_idx];
+
+	if (ts->is_lazy) {
+		uint16_t counter = READ_COUNTER(t, timer_idx) - (_clocked_ts - ts->counter_ts);
+		WRITE_COUNTER(t, timer_idx, counter);
+		ts->counter_ts = _clocked_ts;
+	}
+}
+
+// switches a lazy timer back to regular cycle-by-cycle counting
+static void wakeT(struct Timer* t, uint8_t timer_idx) {
+	syncCounter(t, timer_idx);
+	t->ts[timer_idx].is_lazy = 0;
+}
+
+static void wakeAll() {
+	for (uint8_t i = 0; i < 2; i++) {
+		wakeT(&(_cia[i]), TIMER_A);
+		wakeT(&(_cia[i]), TIMER_B);
+		_cia[i].wake_ts = _clocked_ts;
+	}
+}
 
 static void initTimer(struct Timer* t, uint8_t timer_idx) {
 	// bootstrap using current memory settings..
@@ -273,6 +316,7 @@ static void initTimer(struct Timer* t, uint8_t timer_idx) {
 	t->ts[timer_idx].is_started = memReadIO(addr2) & 0x1;
 
 	t->ts[timer_idx].scripted_transition = 0;
+	t->ts[timer_idx].is_lazy = 0;
 }
 
 // Initialize the timers using whatever settings have been made in
@@ -282,6 +326,10 @@ static void initTimer(struct Timer* t, uint8_t timer_idx) {
 
 static void initTimerBase(uint16_t memory_address, struct Timer* t) {
 	t->memory_address = memory_address;
+
+	// state left over from a previous song must not affect the init below
+	t->ts[TIMER_A].is_lazy = t->ts[TIMER_B].is_lazy = 0;
+	t->wake_ts = _clocked_ts;
 }
 
 static void initTimerData(uint16_t memory_address, struct Timer* t) {
@@ -293,6 +341,7 @@ static void initTimerData(uint16_t memory_address, struct Timer* t) {
 
 	initTimer(t, TIMER_A);
 	initTimer(t, TIMER_B);
+	t->wake_ts = _clocked_ts;
 
 	SYNC_STATUS_CACHE(t, {
 		t->interrupt_mask = memReadIO(t->memory_address + 0x0d) & 0x3;
@@ -595,7 +644,54 @@ static uint8_t clockT(struct Timer* t, uint8_t timer_idx) {
 	return 0;
 }
 
-static void clock(struct Timer* t) {
+// Lazy counters: most of the time a started timer is just counting down to its
+// next underflow and the respective cycle can be predicted in closed form.
+// Instead of updating the io_area counter for each cycle, such a timer is put
+// to "sleep" and the counter is only materialized when it is actually needed
+// (see syncCounter()), i.e. when it is read or when the timer's state is
+// changed via its control register. The regular clockT() handling then only
+// resumes for the cycle in which the underflow occurs.
+//
+// @return the next cycle for which the timer needs regular clockT() handling
+//
+// note: the cycle timestamps wrap around (after ca 72 minutes) and must
+// therefore only be compared via their distance to "now"
+#define SLEEP_MAX 0x7fffffff
+
+static uint32_t sleepT(struct Timer* t, uint8_t timer_idx, uint32_t now) {
+	struct TimerState *ts = &t->ts[timer_idx];
+
+	if (ts->scripted_transition) return now + 1;
+	if (!IS_STARTED(t, timer_idx)) return now + SLEEP_MAX;	// nothing happening here
+
+	uint16_t counter = READ_COUNTER(t, timer_idx);
+	if (counter <= 1) return now + 1;	// underflow in next cycle
+
+	ts->is_lazy = 1;
+	ts->counter_ts = now + 1;
+	return now + counter;				// the cycle that counts down to 0
+}
+
+// interrupt state that HANDLE_INTERRUPT1/HANDLE_INTERRUPT2 will change in the next cycle
+#define IS_INT_PENDING(t) \
+	(t->delay_INT || (t->interrupt_mask_match && !t->interrupt_on))
+
+// @return the next cycle for which the chip needs regular clocking
+static uint32_t sleep(struct Timer* t, uint32_t now) {
+	uint32_t wake = sleepT(t, TIMER_A, now);
+
+	if (!IS_B_LINKED_TO_A(t)) {	// a linked timer B is only clocked via A's underflow
+		uint32_t wake2 = sleepT(t, TIMER_B, now);
+		if ((int32_t)(wake2 - now) < (int32_t)(wake - now)) wake = wake2;
+	}
+
+	if (IS_INT_PENDING(t)) wake = now + 1;
+	return wake;
+}
+
+static void clock(struct Timer* t, uint32_t now) {
+	wakeT(t, TIMER_A);
+	wakeT(t, TIMER_B);
 
 	HANDLE_INTERRUPT1(t);
 
@@ -612,25 +708,46 @@ static void clock(struct Timer* t) {
 	}
 
 	HANDLE_INTERRUPT2(t, 1);
+
+	t->wake_ts = sleep(t, now);
+}
+
+// "PSID only" variant of clock() that ignores timer B
+static void clockA(struct Timer* t, uint32_t now) {
+	wakeT(t, TIMER_A);
+
+	HANDLE_INTERRUPT1(t);
+	clockT(t, TIMER_A);
+	HANDLE_INTERRUPT2(t, 1);
+
+	uint32_t wake = sleepT(t, TIMER_A, now);
+	if (IS_INT_PENDING(t)) wake = now + 1;
+	t->wake_ts = wake;
 }
 
-// todo: NOT handling an unused NMI timer saves about 10%!
-// until started, empty clock functions could be used..
-// this would benefit PSID & RSIDS alike.. similarily the is_b_linked_to_a
-// check could be disabled..
+// a sleeping chip is not clocked at all (e.g. handling an unused NMI timer
+// used to cost about 10%)
+#define CLOCK(t, now, clockFunc) \
+	if ((int32_t)(now - t->wake_ts) >= 0) { \
+		clockFunc(t, now); \
+	}
 
 // disabling the CIA timer clocking & IRQ checks is a
 // quick win for raster PSIDs.. songs ran about 30-34% faster with both
 // removed (still checking the IRQ condition causes a ca 5% slowdown)
-void (*ciaClock)();
+THREAD_LOCAL void (*ciaClock)();
 
 void ciaClockRSID() {
 	// advance all the timers by one clock cycle..
+	const uint32_t now = SYS_CYCLES();
+
 	struct Timer* timer1 = &(_cia[CIA1]);
-	clock(timer1);
+	CLOCK(timer1, now, clock);
 
 	struct Timer* timer2 = &(_cia[CIA2]);
-	clock(timer2);
+	CLOCK(timer2, now, clock);
+
+	_clocked_ts = now + 1;
 }
 
 
@@ -638,28 +755,57 @@ void ciaClockRSID() {
 void ciaClockRasterPSID() {
 	// ideally this would use no timers *at all* - but some RASTER IRQ PSIDs
 	// actually expect to read a live timer... testcase: Delta_Mix-E-Load_loader.sid
-	
+	const uint32_t now = SYS_CYCLES();
+
 	struct Timer* timer1 = &(_cia[CIA1]);
-	clock(timer1);
+	CLOCK(timer1, now, clock);
+
+	_clocked_ts = now + 1;
 }
 
 void ciaClockTimerPSID() {
 	// PSID exclusively uses CIA1/A! (this could probably be further
 	// sped up by replacing the regular timer impl with some dummy
 	// counter.. but I'd rather NOT have more special PSID hacks/retesting)
+	const uint32_t now = SYS_CYCLES();
+
 	struct Timer* timer1 = &(_cia[CIA1]);
-	HANDLE_INTERRUPT1(timer1);
-	clockT(timer1, TIMER_A);
-	HANDLE_INTERRUPT2(timer1, 1);
+	CLOCK(timer1, now, clockA);
+
+	_clocked_ts = now + 1;
 }
 
 
+// event scheduling (see sysClockEvents()): the cycles during which the chips
+// are sleeping can be skipped in one go
+uint32_t ciaCyclesToEvent() {
+	const uint32_t now = SYS_CYCLES();
+
+	int32_t cycles = (int32_t)(_cia[CIA1].wake_ts - now);
+	if (ciaClock == &ciaClockRSID) {
+		const int32_t cycles2 = (int32_t)(_cia[CIA2].wake_ts - now);
+		if (cycles2 < cycles) cycles = cycles2;
+	}
+	return (cycles > 0) ? (uint32_t)cycles + 1 : 1;
+}
+
+void ciaSkip(uint32_t cycles) {
+	// all started timers are sleeping, i.e. there is nothing to count here
+	_clocked_ts = SYS_CYCLES() + cycles;
+}
+
+void ciaSyncCounters() {
+	wakeAll();
+	_clocked_ts = 0;
+	_cia[CIA1].wake_ts = _cia[CIA2].wake_ts = _clocked_ts;
+}
+
 // -----------------------------------------------------------------------
 
 // hack: poor man's "time of day" sim (only secs & 10th of sec),
 // see Kawasaki_Synthesizer_Demo.sid
 
-static uint32_t _tod_in_millies = 0;
+static THREAD_LOCAL uint32_t _tod_in_millies = 0;
 
 static void updateTimeOfDay10thOfSec(uint8_t value) {
 	_tod_in_millies = ((uint32_t)(_tod_in_millies / 1000)) * 1000 + value * 100;
@@ -676,9 +822,16 @@ void ciaUpdateTOD(uint8_t song_speed) {
 // -----------------------------------------------------------------------
 
 
+// any register access may change what the chip is doing next
+#define WAKE_CHIP(addr) \
+	_cia[(addr >> 8) & 0x1].wake_ts = _clocked_ts
+
 uint8_t ciaReadMem(uint16_t addr) {
 	addr &= 0xff0f;	// handle the 16 mirrored CIA registers just in case
 
+	// e.g. reading the ICR acknowledges interrupts
+	WAKE_CHIP(addr);
+
 	switch (addr) {
 		// CIA 1 - "IRQ" timer
 
@@ -692,18 +845,22 @@ uint8_t ciaReadMem(uint16_t addr) {
 
 		case 0xdc04: {
 			struct Timer* t = &(_cia[CIA1]);
+			syncCounter(t, TIMER_A);
 			return READ_COUNTER(t, TIMER_A) & 0xff;
 		}
 		case 0xdc05: {
 			struct Timer* t = &(_cia[CIA1]);
+			syncCounter(t, TIMER_A);
 			return READ_COUNTER(t, TIMER_A) >> 8;
 		}
 		case 0xdc06: {
 			struct Timer* t = &(_cia[CIA1]);
+			syncCounter(t, TIMER_B);
 			return (READ_COUNTER(t, TIMER_B) & 0xff);
 		}
 		case 0xdc07: {
 			struct Timer* t = &(_cia[CIA1]);
+			syncCounter(t, TIMER_B);
 			return (READ_COUNTER(t, TIMER_B) >> 8);
 		}
 
@@ -719,18 +876,22 @@ uint8_t ciaReadMem(uint16_t addr) {
 		// CIA 2 - "NMI" timer
 		case 0xdd04: {
 			struct Timer* t = &(_cia[CIA2]);
+			syncCounter(t, TIMER_A);
 			return READ_COUNTER(t, TIMER_A) & 0xff;
 		}
 		case 0xdd05: {
 			struct Timer* t = &(_cia[CIA2]);
+			syncCounter(t, TIMER_A);
 			return READ_COUNTER(t, TIMER_A) >> 8;
 		}
 		case 0xdd06: {
 			struct Timer* t = &(_cia[CIA2]);
+			syncCounter(t, TIMER_B);
 			return (READ_COUNTER(t, TIMER_B) & 0xff);
 		}
 		case 0xdd07: {
 			struct Timer* t = &(_cia[CIA2]);
+			syncCounter(t, TIMER_B);
 			return (READ_COUNTER(t, TIMER_B) >> 8);
 		}
 
@@ -760,6 +921,8 @@ uint8_t ciaReadMem(uint16_t addr) {
 void ciaWriteMem(uint16_t addr, uint8_t value) {
 	addr &= 0xff0f;	// handle the 16 mirrored CIA registers just in case
 
+	WAKE_CHIP(addr);
+
 	switch (addr) {
 		// CIA 1 - "IRQ" timer
 		case 0xdc04:
@@ -778,9 +941,11 @@ void ciaWriteMem(uint16_t addr, uint8_t value) {
 			setInterruptMask(&(_cia[CIA1]), value);
 			break;
 		case 0xdc0e:
+			wakeT(&(_cia[CIA1]), TIMER_A);
 			setControl(&(_cia[CIA1]), TIMER_A, value);
 			break;
 		case 0xdc0f:
+			wakeT(&(_cia[CIA1]), TIMER_B);
 			setControl(&(_cia[CIA1]), TIMER_B, value);
 			break;
 
@@ -806,9 +971,11 @@ void ciaWriteMem(uint16_t addr, uint8_t value) {
 			setInterruptMask(&(_cia[CIA2]), value);
 			break;
 		case 0xdd0e:
+			wakeT(&(_cia[CIA2]), TIMER_A);
 			setControl(&(_cia[CIA2]), TIMER_A, value);
 			break;
 		case 0xdd0f:
+			wakeT(&(_cia[CIA2]), TIMER_B);
 			setControl(&(_cia[CIA2]), TIMER_B, value);
 			break;
 
@@ -849,6 +1016,7 @@ void ciaSetDefaultsPSID(uint8_t is_timer_driven) {
 
 		ciaClock = &ciaClockRasterPSID;
 	}
+	wakeAll();	// timers that are no longer clocked must not keep counting
 }
 
 void ciaReset(uint8_t is_rsid, uint8_t is_ntsc) {
@@ -22,7 +22,15 @@ void 		ciaSetDefaultsPSID(uint8_t is_timer_driven);
 
 // clocking
 //void 		ciaClock();
-extern void (*ciaClock)();		// ciaClock function pointer (crappy C requires different syntax here)
+extern THREAD_LOCAL void (*ciaClock)();		// ciaClock function pointer (crappy C requires different syntax here)
+void		ciaClockRSID();		// the different ciaClock implementations
+void		ciaClockRasterPSID();
+void		ciaClockTimerPSID();
+
+// event scheduling (see sysClockEvents())
+uint32_t	ciaCyclesToEvent();	// 1 = the next ciaClock() must be run
+void		ciaSkip(uint32_t cycles);
+void		ciaSyncCounters();	// must be called before the system clock is reset
 
 // CPU interactions
 uint8_t 	ciaNMI();
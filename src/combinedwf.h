@@ -0,0 +1,1059 @@
+/*
+* Hermit's precalculated "combined waveforms" (see WaveGenerator::combinedWF).
+*
+* Caution: This file is generated by native/src/websid_wftables.cpp - do not edit!
+*/
+#ifndef WEBSID_COMBINEDWF_H
+#define WEBSID_COMBINEDWF_H
+
+#include <stdint.h>
+
+#define WF_TABLE_SIZE 4096
+
+struct CombinedWaveforms {
+	uint16_t TriSaw_8580[WF_TABLE_SIZE];
+	uint16_t PulseSaw_8580[WF_TABLE_SIZE];
+	uint16_t PulseTri_8580[WF_TABLE_SIZE];
+	uint16_t PulseTriSaw_8580[WF_TABLE_SIZE];
+};
+
+static const struct CombinedWaveforms DEFAULT_COMBINED_WAVEFORMS = {
+	// TriSaw_8580: bitmul 0.8, bitstrength 2.4, threshold 0.64
+	{
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,192,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		1536,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2352,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,768,768,768,852,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,384,384,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4692,
+		4608,4608,4608,4608,4608,4608,4608,4632,4608,4608,4608,4608,4608,4704,4752,4788,
+		5376,5376,5376,5376,5376,5376,5376,5400,5376,5376,5376,5376,5376,5376,5424,5460,
+		5760,5760,5760,5760,5760,5760,5760,5784,5952,5952,5952,5952,6048,6048,6096,6132,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,1536,1536,1536,1536,1536,1632,1680,1716,
+		2304,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2352,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,768,768,768,768,768,768,768,852,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,384,384,384,408,6720,6720,6720,6720,6816,6816,6864,6900,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9300,
+		9216,9216,9216,9216,9216,9216,9216,9240,9216,9216,9216,9216,9216,9216,9360,9396,
+		9216,9216,9216,9216,9216,9216,9216,9240,9216,9216,9216,9216,9216,9216,9216,9300,
+		9216,9216,9216,9216,9216,9216,9216,9240,9216,9216,9408,9408,9504,9504,9552,9588,
+		10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10836,
+		10752,10752,10752,10752,10752,10752,10752,10776,10752,10752,10752,10752,10752,10848,10896,10932,
+		11520,11520,11520,11520,11520,11520,11520,11544,11520,11520,11520,11520,11520,11520,11568,11604,
+		11904,11904,11904,11904,11904,11904,11904,11928,12096,12096,12096,12096,12192,12192,12240,12276,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		2304,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2352,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,768,768,768,768,852,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,384,384,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,3072,3072,3072,3072,3072,3072,3072,3156,
+		3072,3072,3072,3072,3072,3072,3072,3096,3072,3072,3264,3264,3360,3360,3408,3444,
+		4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4692,
+		4608,4608,4608,4608,4608,4608,4608,4632,4608,4608,4608,4608,4608,4704,4752,4788,
+		5376,5376,5376,5376,5376,5376,5376,5400,5376,5376,5376,5376,5376,5376,5424,5460,
+		5760,5760,5760,5760,5760,5760,5760,5784,5952,5952,5952,5952,6048,6048,6096,6132,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,384,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		1536,1536,1536,1536,1536,1536,1536,1560,1536,1536,1536,1536,1536,1632,1680,1716,
+		2304,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2352,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12288,12432,12468,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12864,12864,12864,12864,12960,12960,13008,13044,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12288,12432,12468,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12480,12576,12576,12624,12660,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12384,12432,12468,
+		12288,12288,12288,12288,12288,12288,12288,12312,13056,13056,13056,13056,13056,13056,13056,13140,
+		13440,13440,13440,13440,13440,13440,13440,13464,13632,13632,13632,13632,13728,13728,13776,13812,
+		43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43092,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43008,43008,43152,43188,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43008,43008,43008,43092,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43296,43296,43344,43380,
+		43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43092,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43008,43104,43152,43188,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43008,43008,43008,43092,
+		43008,43008,43008,43008,43392,43392,43392,43416,43584,43584,43584,43584,43680,43680,43728,43764,
+		46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46164,
+		46080,46080,46080,46080,46080,46080,46080,46104,46080,46080,46080,46080,46080,46080,46224,46260,
+		46080,46080,46080,46080,46080,46080,46080,46104,46080,46080,46080,46080,46080,46080,46080,46164,
+		46080,46080,46080,46080,46080,46080,46080,46104,46080,46080,46272,46272,46368,46368,46416,46452,
+		47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47700,
+		47616,47616,47616,47616,47616,47616,47616,47640,47616,47616,47616,47616,47616,47712,47760,47796,
+		48384,48384,48384,48384,48384,48384,48384,48408,48384,48384,48384,48384,48384,48384,48432,48468,
+		48768,48768,48768,48768,48768,48768,48768,48792,48960,48960,48960,48960,49056,49056,49104,49140,
+	},
+	// PulseSaw_8580: bitmul 1.4, bitstrength 1.9, threshold 0.68
+	{
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,180,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,84,192,192,288,324,336,336,360,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,564,
+		0,384,384,396,576,576,624,660,576,672,672,708,720,732,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,144,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,0,240,660,576,672,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,84,0,0,288,324,288,336,1128,1140,
+		0,768,768,780,768,768,768,1236,1152,1152,1152,1188,1248,1296,1320,1332,
+		1152,1152,1344,1380,1344,1344,1416,1428,1440,1440,1440,3012,3024,3036,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,276,192,192,288,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,420,384,528,1320,1332,
+		1152,1152,1152,1356,1344,1344,1392,1428,1344,1440,1440,1476,1488,1500,1512,1524,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,396,384,576,624,660,576,672,672,2244,2256,2268,2280,2292,
+		1536,1536,1536,1548,1536,1536,1536,1620,1536,1536,1536,1572,1536,1584,2472,2484,
+		2304,2304,2304,2316,2304,2304,2352,2388,2304,2496,2592,2628,2640,2640,2664,2676,
+		2304,2304,2304,2700,2688,2688,2688,2772,2688,2688,2688,2724,2784,5904,5928,6132,
+		5760,5952,5952,5988,5952,5952,6024,6132,6048,6048,6048,6084,6096,6108,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,276,192,192,288,324,336,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,528,552,564,
+		384,384,384,588,576,576,1392,1428,1344,1440,1440,1476,1488,1500,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,576,624,660,576,672,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,768,852,768,960,1056,2628,2592,2640,2664,2676,
+		2304,2304,2304,2316,2304,2688,2688,2772,2688,2688,2688,2724,2784,2832,2856,2868,
+		2688,2880,2880,2916,2880,2880,2952,2964,2976,2976,2976,3012,3024,3036,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,240,276,192,576,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,192,324,288,336,360,372,
+		0,0,0,12,0,0,768,852,768,1152,1152,1188,1152,4368,4392,4404,
+		4224,4224,4416,4452,4416,4416,4488,4500,4416,4512,4512,4548,4560,4572,4584,4596,
+		3072,3072,3072,3084,3072,3072,3072,3108,3072,3072,3072,3108,3072,3072,3144,3252,
+		3072,3072,3072,3084,3072,3072,3072,3156,3072,3072,3072,4740,4896,4944,4968,4980,
+		4608,4608,4608,4620,4608,4608,4608,4692,4608,4608,4608,4644,4608,4752,4776,4788,
+		4608,4992,4992,5004,5184,5184,5232,5268,11328,11424,11424,11460,11472,11484,11496,11508,
+		10752,10752,10752,10764,10752,10752,11520,11604,11520,11520,11520,11556,11520,11568,11688,11700,
+		11520,11520,11520,11532,11520,11520,11568,11604,11712,11712,11808,11844,11856,11868,11880,12276,
+		11520,11904,11904,11916,11904,11904,11904,11988,11904,11904,11904,11940,12000,12048,12072,12276,
+		12096,12096,12096,12132,12096,12096,12168,12276,12192,12192,12192,12228,12240,12252,12264,12276,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,180,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,84,192,192,288,324,336,348,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,552,564,
+		384,384,384,396,576,576,624,660,576,672,1440,1476,1488,1500,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,144,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,0,624,660,576,672,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,84,0,0,1056,1092,1056,1104,1128,1140,
+		768,768,768,780,768,768,1152,1236,1152,1152,1152,2724,2784,2832,2856,2868,
+		2688,2688,2880,2916,2880,2880,2952,2964,2976,2976,2976,3012,3024,3036,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,276,192,192,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,1152,1188,1152,1296,1320,1332,
+		1152,1152,1152,1356,1344,1344,1392,1428,1344,1440,1440,1476,1488,1500,1512,1524,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,1572,1536,4752,4776,4788,
+		4608,4608,4992,5004,4992,5184,5232,5268,5184,5280,5280,5316,5328,5340,5352,5364,
+		4608,4608,4608,4620,4608,4608,4608,4692,4608,4608,5376,5412,5376,5424,5544,5556,
+		5376,5376,5376,5388,5376,5376,5424,5460,5376,5568,5664,5700,5712,5712,5736,5748,
+		5376,5376,5760,5772,5760,5760,5760,5844,5760,5760,5760,5796,5856,5904,5928,6132,
+		5760,5952,5952,5988,5952,5952,6024,6132,6048,6048,6048,6084,6096,6108,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,276,192,192,288,324,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,384,528,552,564,
+		384,384,1152,1356,1344,1344,1392,1428,1344,1440,1440,1476,1488,1500,1512,1524,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,384,576,624,660,6720,6816,6816,6852,6864,6876,6888,6900,
+		6144,6144,6144,6156,6144,6144,6144,6180,6144,6144,6144,7716,7680,7680,7848,7860,
+		7680,7680,8448,8460,8448,8448,8448,8532,8448,8640,8736,8772,8736,8784,8808,8820,
+		8448,8448,8448,8460,8832,8832,8832,8916,8832,8832,8832,21156,21216,21264,21288,21300,
+		21120,21312,21312,21348,21312,21312,21384,21396,21408,21408,21408,21444,21456,21468,21480,21492,
+		6144,18432,18432,18432,18432,18432,18432,18468,18432,18432,18432,18468,18432,18432,18504,18612,
+		18432,18432,18432,18444,18432,18432,18432,18516,18432,18432,18432,18564,18528,18576,18792,18804,
+		18432,18432,18432,18444,18432,18432,18432,18516,18432,18432,18432,18468,18432,21648,21672,21684,
+		21504,21504,21504,21516,21504,21504,21744,21780,22080,22176,22176,22212,22224,22236,22248,22260,
+		21504,21504,21504,21516,21504,21504,21504,21540,21504,21504,21504,21540,21504,21504,21672,21684,
+		21504,21504,21504,21516,21504,21504,21504,21588,21504,21504,21792,21828,21792,21840,21864,21876,
+		21504,21504,22272,22284,22272,22272,22272,22356,22656,22656,22656,22692,22752,22800,22824,22836,
+		22656,22656,22848,22884,22848,22848,22920,22932,22944,22944,22944,22980,22992,23004,23016,23028,
+		21504,21504,21504,21516,21504,21504,21504,21540,21504,21504,21504,23076,23040,23040,23112,23220,
+		23040,23040,23040,23052,23040,23040,23040,23124,23040,23040,23040,23172,23328,23376,23400,23412,
+		23040,23040,23040,23052,23040,23040,23040,23124,23040,23040,23040,23076,23040,23184,23208,23604,
+		23424,23424,23424,23436,23616,23616,23664,23700,23616,23712,23712,23748,23760,24540,24552,24564,
+		23040,23040,23808,23820,23808,23808,23808,23892,23808,23808,23808,23844,23808,23856,23976,23988,
+		23808,23808,23808,23820,23808,23808,23856,24084,24000,24000,24096,24132,24144,24156,24552,24564,
+		24192,24192,24192,24204,24192,24192,24192,24276,24192,24192,24192,24228,24288,24336,24360,24564,
+		24384,24384,24384,24420,24384,24384,24456,24564,24480,24480,24480,24516,24528,24540,24552,24564,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,180,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,84,192,192,288,324,336,336,360,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,564,
+		384,384,384,396,576,576,624,660,576,672,672,708,1488,1500,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,144,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,0,240,660,576,672,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,84,0,0,288,324,1056,1104,1128,1140,
+		768,768,768,780,768,768,768,1236,1152,1152,1152,1188,1248,1296,1320,1332,
+		1152,1152,1344,2916,2880,2880,2952,2964,2976,2976,2976,3012,3024,3036,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,276,192,192,288,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,420,1152,1296,1320,1332,
+		1152,1152,1152,1356,1344,1344,1392,1428,1344,1440,1440,1476,1488,1500,1512,1524,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,1932,1920,2112,2160,2196,2112,2208,2208,2244,2256,2268,2280,2292,
+		1536,1536,1536,1548,1536,1536,1536,1620,1536,1536,1536,1572,2304,5424,5544,5556,
+		5376,5376,5376,5388,5376,5376,5424,5460,5376,5568,5664,5700,5712,5712,5736,5748,
+		5376,5376,5376,5772,5760,5760,5760,5844,5760,5760,5760,5796,5856,5904,5928,6132,
+		5760,5952,5952,5988,5952,5952,6024,6132,6048,6048,6048,6084,6096,6108,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,0,0,84,0,0,0,36,96,144,168,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,276,192,192,288,324,336,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,528,552,564,
+		384,384,384,588,1344,1344,1392,1428,1344,1440,1440,1476,1488,1500,1512,1524,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,336,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,576,624,660,576,672,672,708,720,732,744,756,
+		0,0,0,12,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,1548,2304,2304,2304,2388,2304,2496,2592,2628,2592,2640,2664,2676,
+		2304,2304,2304,2316,2304,2688,2688,2772,2688,2688,2688,2724,2784,2832,2856,2868,
+		2688,2880,2880,2916,2880,2880,2952,2964,2976,2976,2976,3012,3024,3036,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,144,360,372,
+		0,0,0,12,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,0,240,276,6336,6816,6816,6852,6864,6876,6888,6900,
+		6144,6144,6144,6156,6144,6144,6144,6180,6144,6144,6144,6180,6144,9216,9384,9396,
+		9216,9216,9216,9228,9216,9216,9216,9300,9216,9216,9504,9540,9504,9552,9576,9588,
+		9216,9216,9216,9228,9984,9984,9984,10068,9984,10368,10368,10404,10464,10512,10536,10548,
+		10368,10368,10560,10596,10560,10560,10632,10644,10656,10656,10656,10692,10704,10716,10728,10740,
+		9216,9216,9216,9228,9216,9216,9216,9252,9216,9216,9216,9252,9216,9216,9288,9396,
+		9216,9216,9216,10764,10752,10752,10752,10836,10752,10752,10752,10884,11040,11088,11112,11124,
+		10752,10752,10752,10764,10752,10752,10752,10836,10752,10752,10752,10788,10752,10896,10920,10932,
+		10752,11136,11136,11148,11328,11328,11376,11412,11328,11424,11424,11460,36048,36060,36072,36852,
+		10752,10752,35328,35340,36096,36096,36096,36180,36096,36096,36096,36132,36096,36144,36264,36276,
+		36096,36096,36096,36108,36096,36096,36144,36372,36288,36288,36384,36420,36432,36444,36840,36852,
+		36096,36480,36480,36492,36480,36480,36480,36564,36480,36480,36480,36516,36576,36624,36648,36852,
+		36672,36672,36672,36708,36672,36672,36744,36852,36768,36768,36768,36804,36816,36828,36840,36852,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,84,
+		0,0,0,12,0,24576,24576,24660,24576,24576,24576,24612,24672,24720,24744,24948,
+		24576,24576,24576,24588,24576,24576,24576,24660,24576,24576,24576,24612,24576,24624,24744,24756,
+		24576,24576,24576,24588,24576,24576,24624,24852,24768,24768,24864,24900,24912,24924,25320,25332,
+		24576,24576,24576,24588,24576,24576,24576,24612,24576,24576,24576,24612,24576,24576,24648,24756,
+		24576,24576,24576,24588,24576,24576,24576,24660,24576,24576,24576,24900,24864,24912,24936,24948,
+		24576,24576,24576,24588,24576,24576,24576,24660,24576,24576,24576,24612,24576,24720,25128,25140,
+		24960,24960,24960,25164,25152,25152,25200,25236,25920,26016,26016,26052,26064,26076,26088,26100,
+		24576,24576,24576,24576,24576,24576,24576,24612,24576,24576,24576,24612,24576,24576,24648,24756,
+		24576,24576,24576,24588,24576,24576,24576,24660,24576,24576,24576,24708,24672,24912,24936,24948,
+		24576,24576,24576,24588,24576,24576,24576,24660,24576,24576,24576,24612,24576,24720,24744,24756,
+		24576,24576,24576,24588,24576,24768,25200,25236,25152,25248,25248,25284,25296,25308,25320,25332,
+		24576,24576,24576,24588,24576,24576,24576,24612,24576,24576,24576,24612,24576,24576,24744,24756,
+		24576,24576,24576,24588,24576,24576,24576,24660,25344,25536,25632,25668,25632,25680,25704,25716,
+		25344,25344,25344,26892,26880,26880,27264,27348,27264,27264,27264,39588,39648,39696,39720,39732,
+		39552,39744,39744,39780,39744,39744,39816,39828,39840,39840,39840,39876,39888,39900,39912,39924,
+		24576,36864,36864,36864,36864,36864,36864,36900,36864,36864,36864,36900,36864,36864,36936,36948,
+		36864,36864,36864,36876,36864,36864,36864,36948,36864,36864,36864,36900,36960,37008,37224,37236,
+		36864,36864,36864,36876,36864,36864,36864,36948,36864,36864,36864,36900,36864,36912,37032,37044,
+		36864,36864,36864,36876,36864,36864,37104,37140,37056,37056,37536,37572,37584,37596,37608,37620,
+		36864,36864,36864,36876,36864,36864,36864,36900,36864,36864,36864,36900,36864,36864,36936,37044,
+		36864,36864,36864,36876,36864,36864,36864,36948,36864,36864,37056,37188,37152,37200,37224,37236,
+		36864,36864,36864,36876,36864,36864,36864,36948,37632,37632,38016,38052,38016,38160,38184,38196,
+		38016,38016,38208,38244,38208,38208,38280,38292,38208,38304,38304,38340,38352,38364,38376,38388,
+		36864,36864,36864,36876,36864,36864,36864,36900,36864,36864,36864,36900,36864,39936,40008,40116,
+		39936,39936,39936,39948,39936,39936,39936,40020,39936,39936,39936,40068,40224,40272,40296,40308,
+		39936,39936,39936,41484,41472,41472,41472,41556,41472,41472,41472,41508,41472,41616,41640,41652,
+		41472,41472,41856,41868,42048,42048,42096,42132,42048,42144,42144,42180,42192,42204,42216,42228,
+		41472,41472,41472,41484,41472,41472,41472,41556,42240,42240,42240,42276,42240,42288,42408,42420,
+		42240,42240,42240,42252,42240,42240,42288,42324,42432,42432,42528,42564,42576,42576,42600,42996,
+		42240,42240,42624,42636,42624,42624,42624,42708,42624,42624,42624,42660,42720,42768,42792,42996,
+		42816,42816,42816,42852,42816,42816,42888,42996,42912,42912,42912,42948,42960,42972,42984,42996,
+		36864,36864,36864,36864,36864,36864,36864,36900,36864,36864,36864,36900,36864,36864,36936,36948,
+		36864,36864,36864,36876,36864,36864,36864,36948,36864,36864,36864,36900,36960,37008,37032,37236,
+		36864,36864,36864,36876,36864,36864,36864,36948,36864,36864,36864,36900,36864,36912,37032,37044,
+		36864,36864,36864,36876,36864,36864,36912,37140,43200,43200,43296,43332,43728,43740,43752,43764,
+		43008,43008,43008,43020,43008,43008,43008,43044,43008,43008,43008,43044,43008,43008,43080,43188,
+		43008,43008,43008,43020,43008,43008,43008,43092,43008,43008,43008,43332,43296,43344,43368,43380,
+		43008,43008,43008,43020,43008,43008,43008,43092,43008,43008,43008,43044,43392,43536,43560,44340,
+		44160,44160,44160,44364,44352,44352,44400,44436,44352,44448,44448,44484,44496,44508,44520,44532,
+		43008,43008,43008,43020,43008,43008,43008,43044,43008,43008,43008,43044,43008,43008,43080,43188,
+		43008,43008,43008,43020,43008,43008,43008,43092,43008,43008,43008,43140,43104,43344,43368,43380,
+		43008,43008,43008,43020,43008,43008,43008,43092,43008,43008,43008,43044,43008,43152,43176,43188,
+		43008,43008,43008,43020,43392,43584,43632,43668,43584,43680,43680,43716,43728,45276,45288,45300,
+		43008,43008,43008,44556,44544,44544,44544,44580,44544,44544,44544,44580,44544,44544,44712,45492,
+		45312,45312,45312,45324,45312,45312,45312,45396,45312,45504,45600,45636,45600,45648,45672,45684,
+		45312,45312,45312,45324,45696,45696,45696,45780,45696,45696,45696,45732,45792,45840,45864,45876,
+		45696,45888,45888,45924,45888,45888,45960,49140,49056,49056,49056,49092,49104,49116,49128,49140,
+		43008,43008,43008,43008,43008,43008,43008,43044,43008,43008,43008,43044,43008,46080,46152,46260,
+		46080,46080,46080,46092,46080,46080,46080,46164,46080,46080,46080,46212,46176,46224,46440,46452,
+		46080,46080,46080,46092,46080,46080,46080,46164,46080,46080,46080,46116,46080,46224,46248,46260,
+		46080,46080,46080,46092,46080,46080,46320,46740,46656,46752,46752,46788,46800,46812,46824,46836,
+		46080,46080,46080,46092,46080,46080,46080,46116,46080,46080,46080,46116,46080,46080,46248,46260,
+		46080,46080,46080,46092,46080,46080,46080,46164,46080,46080,46368,46404,46368,46416,47208,47220,
+		46848,46848,46848,46860,46848,46848,46848,47316,47232,47232,47232,47268,47328,47376,47400,47412,
+		47232,47232,47424,47460,47424,47424,47496,47508,49056,49056,49056,49092,49104,49116,49128,49140,
+		46080,46080,46080,47628,47616,47616,47616,47652,47616,47616,47616,47652,47616,47616,47688,47796,
+		47616,47616,47616,47628,47616,47616,47616,47700,47616,47616,47616,47748,47904,47952,47976,47988,
+		47616,47616,47616,47628,47616,47616,47616,47700,47616,47616,47616,47652,47616,47760,47784,48180,
+		48000,48000,48000,48012,48192,48192,48240,48276,48192,48288,48288,49092,49104,49116,49128,49140,
+		48384,48384,48384,48396,48384,48384,48384,48468,48384,48384,48384,48420,48384,48432,48552,48564,
+		48384,48384,48384,48396,48384,48384,48432,48660,48576,48576,48672,48708,48720,49116,49128,49140,
+		48768,48768,48768,48780,48768,48768,48768,48852,48768,48768,48768,48804,48864,48912,48936,49140,
+		48960,48960,48960,48996,48960,48960,49032,49140,49056,49056,49056,49092,49104,49116,49128,49140,
+	},
+	// PulseTri_8580: bitmul 0.8, bitstrength 1.5, threshold 0.38 - improved settings are welcome!
+	{
+		0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,348,360,372,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,0,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,36,0,576,648,756,576,672,672,756,720,756,744,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,372,0,192,288,756,720,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,372,360,1524,
+		0,0,0,0,0,0,0,84,0,0,768,1284,1152,1308,1512,1524,
+		1152,1152,1152,1380,1344,1392,1512,1524,1344,1440,1440,3060,3024,3060,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,372,0,192,288,372,288,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,540,552,1524,
+		0,384,384,1380,576,1344,1512,1524,1344,1440,1440,1524,1488,1524,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,756,
+		0,0,0,36,0,576,648,756,576,672,672,2292,2256,3060,3048,3060,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,1584,1704,2484,
+		0,0,0,2316,1536,2304,2352,2676,2304,2496,2592,3060,3024,3060,3048,3060,
+		2304,2304,2304,2316,2304,2688,2688,2772,2688,2688,2688,3012,2784,6108,6120,6132,
+		2688,5952,5952,5988,5952,6096,6120,6132,6048,6048,6048,6132,6096,6132,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,276,0,0,288,372,288,372,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,552,756,
+		0,0,0,612,384,576,648,1524,576,1440,1440,1524,1488,1524,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,0,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,192,624,756,192,672,672,756,720,756,744,1524,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,1140,0,960,1056,2676,2592,3060,3048,3060,
+		0,0,768,780,768,2304,2688,2772,2304,2688,2688,2820,2784,3036,3048,3060,
+		2688,2880,2880,2916,2880,3024,3048,3060,2976,2976,2976,3060,3024,3060,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,240,756,0,192,672,756,720,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,192,372,288,1140,1512,1524,
+		0,0,0,0,0,0,0,1236,0,768,1152,1284,1152,4572,4584,4596,
+		1152,4224,4416,4452,4416,4464,6120,6132,4416,6048,6048,6132,6096,6132,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,3252,
+		0,0,0,12,0,3072,3072,3156,3072,3072,3072,4932,4896,4956,4968,4980,
+		0,3072,3072,3072,3072,4608,4608,4692,4608,4608,4608,4644,4608,5148,5160,12276,
+		4608,4608,4992,11364,5184,12096,12168,12276,12096,12192,12192,12276,12240,12276,12264,12276,
+		4608,4608,4608,4608,4608,4608,10752,11604,4608,11520,11520,11556,11520,11664,11688,11700,
+		11520,11520,11520,11532,11520,11520,12144,12276,11712,12192,12192,12276,12240,12276,12264,12276,
+		11520,11520,11904,11916,11904,11904,11904,11988,11904,11904,11904,12276,12192,12276,12264,12276,
+		12096,12096,12096,12132,12096,12252,12264,12276,12192,12192,12240,12276,12240,12276,12264,12276,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,372,360,756,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,756,
+		0,0,0,420,384,576,648,756,576,672,672,1524,1488,1524,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,0,156,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,0,240,756,0,672,672,756,720,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,276,0,0,288,1140,1056,1524,1512,3060,
+		0,0,0,0,0,768,768,1236,768,1152,1152,2820,2784,3036,3048,3060,
+		1152,2688,2880,2916,2880,2928,3048,3060,2976,2976,2976,3060,3024,3060,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,372,0,192,288,756,720,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,348,360,1524,
+		0,0,0,0,0,0,0,84,0,0,0,1284,1152,1308,1512,1524,
+		384,1152,1152,1380,1344,1392,1512,1524,1344,1440,1440,1524,1488,6132,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,96,348,360,1908,
+		0,0,0,0,0,0,0,84,0,0,0,1572,1536,4764,5160,5364,
+		0,4608,4608,5220,4992,5184,5256,6132,5184,6048,6048,6132,6096,6132,6120,6132,
+		0,0,0,4608,4608,4608,4608,4692,4608,4608,4608,5412,5376,5520,5544,5556,
+		4608,5376,5376,5388,5376,5376,5616,6132,5376,6048,6048,6132,6096,6132,6120,6132,
+		5376,5376,5376,5772,5760,5760,5760,5844,5760,5760,5760,6132,6048,6108,6120,6132,
+		5760,5952,5952,5988,5952,6108,6120,12276,6048,12192,12240,12276,12240,12276,12264,24564,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,372,0,192,288,756,336,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,420,0,540,1512,1524,
+		0,384,384,1380,1344,1344,1512,1524,1344,1440,1440,1524,1488,1524,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,6900,
+		0,0,0,6564,0,6720,6792,8436,6720,8352,8352,9204,9168,21492,21480,21492,
+		0,0,0,0,0,0,6144,6228,0,6144,6144,7716,7680,7728,8616,20916,
+		6144,7680,7680,20748,8448,20736,20784,21108,20736,20928,21024,24564,21456,24564,24552,24564,
+		20736,20736,20736,21132,20736,24192,24192,24276,24192,24192,24192,24516,24480,24540,24552,24564,
+		24192,24384,24384,24420,24384,24528,24552,24564,24480,24480,24480,24564,24528,24564,24552,24564,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,6144,6192,6324,
+		0,0,0,6144,6144,6144,6144,6228,6144,6144,6144,18564,18432,18780,18792,18804,
+		6144,6144,6144,6144,6144,18432,18432,18516,18432,18432,18432,18468,18432,21648,21672,21684,
+		18432,21504,21504,21516,21504,21696,22128,22260,21696,22176,22176,22260,22224,22260,22248,23028,
+		18432,18432,18432,21504,21504,21504,21504,21540,21504,21504,21504,21540,21504,21504,21672,21684,
+		21504,21504,21504,21516,21504,21504,21504,22644,21504,22464,22560,22644,22560,24564,24552,24564,
+		21504,21504,21504,22284,22272,22272,24192,24276,22272,24192,24192,24324,24288,24540,24552,24564,
+		24192,24384,24384,24420,24384,24528,24552,24564,24480,24480,24480,24564,24528,24564,24552,24564,
+		21504,21504,21504,21504,21504,21504,21504,21540,21504,21504,21504,23076,23040,23040,23112,23220,
+		21504,23040,23040,23052,23040,23040,23040,23124,23040,23040,23040,23412,23328,23388,23400,24564,
+		23040,23040,23040,23040,23040,23040,23040,23124,23040,23040,23040,24324,24192,24348,24552,24564,
+		23040,24192,24192,24420,24384,24384,24552,24564,24384,24480,24480,24564,24528,24564,24552,24564,
+		23040,23040,23040,23808,23808,23808,23808,23892,23808,23808,23808,23844,23808,23964,23976,24564,
+		23808,23808,23808,23844,23808,24384,24456,24564,24384,24480,24480,24564,24528,24564,24552,24564,
+		23808,24192,24192,24204,24192,24192,24192,24468,24192,24192,24480,24564,24480,24564,24552,24564,
+		24384,24384,24384,24420,24384,24540,24552,24564,24480,24480,24528,24564,24528,24564,49140,49140,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,348,360,756,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,756,
+		0,0,0,36,0,576,648,756,576,672,672,1524,720,1524,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,0,156,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,180,
+		0,0,0,12,0,0,240,756,0,672,672,756,720,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,276,0,0,288,1140,288,1140,1512,1524,
+		0,0,0,0,0,0,768,1236,768,1152,1152,1284,1248,1500,3048,3060,
+		1152,1152,1344,2916,2880,2928,3048,3060,2976,2976,2976,3060,3024,3060,3048,3060,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,168,180,
+		0,0,0,12,0,0,48,372,0,192,288,756,720,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,372,288,348,360,756,
+		0,0,0,0,0,0,0,84,0,0,0,1284,384,1308,1512,1524,
+		0,1152,1152,1380,1344,1344,1512,1524,1344,1440,1440,1524,1488,1524,1512,3060,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,132,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,2088,2292,
+		0,0,0,1956,1920,2112,2184,6132,2112,2208,6048,6132,6096,6132,6120,6132,
+		0,0,0,0,0,1536,1536,1620,1536,1536,1536,2340,1536,5424,5544,5556,
+		1536,5376,5376,5388,5376,5376,5616,6132,5376,5568,6048,6132,6096,6132,6120,6132,
+		5376,5376,5376,5772,5760,5760,5760,5844,5760,5760,5760,6132,6048,6108,6120,6132,
+		5760,5952,5952,5988,5952,6108,6120,6132,6048,6048,6096,6132,6096,6132,6120,6132,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,372,0,192,288,372,288,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,72,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,288,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,540,552,1524,
+		0,0,384,1380,576,1344,1512,1524,1344,1440,1440,1524,1488,1524,1512,1524,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,756,
+		0,0,0,36,0,576,648,756,576,672,672,2292,720,3060,3048,3060,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,48,1704,2484,
+		0,0,0,2316,1536,2304,2352,2676,2304,2496,2592,3060,3024,3060,3048,9204,
+		2304,2304,2304,2316,2304,2688,2688,8916,2688,2688,8832,9156,8928,9180,12264,12276,
+		8832,9024,9024,12132,12096,12240,12264,36852,12192,36768,36768,36852,36816,36852,36840,36852,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,0,0,0,0,84,0,0,0,132,0,156,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,144,168,6324,
+		0,0,0,6156,0,6144,6384,9972,6336,6816,9888,9972,9936,34548,34536,34548,
+		0,0,0,0,0,0,6144,6180,0,6144,6144,6180,6144,9216,9384,33972,
+		6144,9216,9216,9228,9216,33792,33792,34068,33792,33792,34080,34932,34848,35316,35304,36852,
+		9216,33792,33792,34560,33792,34560,34560,35028,34560,34944,34944,36612,36576,36828,36840,36852,
+		34944,36480,36672,36708,36672,36720,36840,36852,36768,36768,36768,49140,49104,49140,49128,49140,
+		6144,9216,9216,33792,33792,33792,33792,33828,33792,33792,33792,33828,33792,33792,35400,35508,
+		33792,33792,33792,35340,35328,35328,35328,35412,35328,35328,35328,35700,35616,35676,35688,48372,
+		35328,35328,35328,35328,35328,35328,35328,35412,35328,35328,35328,48132,48000,48924,49128,49140,
+		47616,48000,48768,48996,48960,48960,49128,49140,48960,49056,49056,49140,49104,49140,49128,49140,
+		35328,35328,47616,48384,47616,48384,48384,48468,48384,48384,48384,48420,48384,48540,48552,49140,
+		48384,48384,48384,48420,48384,48960,49032,49140,48960,49056,49056,49140,49104,49140,49128,49140,
+		48384,48768,48768,48780,48768,48768,48768,49044,48768,48768,49056,49140,49056,49140,49128,49140,
+		48960,48960,48960,48996,48960,49116,49128,49140,49056,49056,49104,49140,49104,49140,49128,49140,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,0,84,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,156,168,372,
+		0,0,0,0,0,0,0,36,0,0,0,36,0,0,168,180,
+		0,0,0,12,0,0,0,276,0,0,288,372,288,756,744,756,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,12,0,0,0,84,0,0,0,324,96,348,360,372,
+		0,0,0,0,0,0,0,84,0,0,0,36,0,540,25128,25332,
+		0,0,0,25188,24960,25152,25992,26100,25152,26016,26016,26100,26064,26100,26088,26100,
+		0,0,0,0,0,0,0,36,0,0,0,12,0,0,48,180,
+		0,0,0,0,0,0,24576,24660,0,24576,24576,24708,24576,24924,24936,24948,
+		0,24576,24576,24576,24576,24576,24576,24660,24576,24576,24576,24612,24576,24720,24744,24756,
+		24576,24576,24576,24612,24576,25152,25224,25332,25152,25248,25248,25332,25296,37620,37608,38388,
+		24576,24576,24576,24576,24576,24576,24576,24660,24576,24576,24576,24612,24576,24624,24744,37044,
+		24576,24576,24576,36876,24576,36864,37680,39540,36864,37824,39456,39924,39504,39924,39912,39924,
+		36864,36864,37632,39180,39168,39552,39552,39636,39552,39552,39552,39684,39648,39900,39912,39924,
+		39552,39744,39744,39780,39744,39888,39912,39924,39840,39840,39840,39924,39888,39924,39912,42996,
+		0,24576,24576,24576,24576,24576,24576,24612,24576,24576,24576,24588,24576,24576,24576,24660,
+		24576,24576,24576,24576,24576,24576,24576,24660,24576,24576,24576,36900,36864,37020,37224,37236,
+		24576,24576,24576,24576,24576,36864,36864,36948,36864,36864,36864,36900,36864,36912,37032,37044,
+		36864,36864,36864,36876,36864,36864,37104,37620,36864,37440,37536,37620,37584,37620,37608,37620,
+		36864,36864,36864,36864,36864,36864,36864,36900,36864,36864,36864,36900,36864,36864,36936,37044,
+		36864,36864,36864,36876,36864,36864,36864,37140,36864,36864,37056,37236,37152,41076,41448,41460,
+		36864,36864,36864,36864,36864,36864,37632,41172,36864,41088,41088,41220,41088,41436,41448,42996,
+		41088,41088,41280,41316,41280,42864,42984,49140,42816,49056,49056,49140,49104,49140,49128,49140,
+		36864,36864,36864,36864,36864,36864,36864,36900,36864,36864,36864,36900,36864,39936,40008,40116,
+		36864,39936,39936,39948,39936,39936,39936,41556,39936,39936,41472,47988,41760,47964,47976,47988,
+		39936,39936,39936,41472,41472,41472,47616,47700,47616,47616,47616,47652,47616,48156,48168,49140,
+		47616,48000,48000,48996,48192,48960,49128,49140,48960,49056,49056,49140,49104,49140,49128,49140,
+		47616,47616,47616,47616,47616,47616,48384,48468,47616,48384,48384,48420,48384,48528,48552,48564,
+		48384,48384,48384,48396,48384,48576,49008,49140,48576,49056,49056,49140,49104,49140,49128,49140,
+		48384,48768,48768,48780,48768,48768,48768,48852,48768,48768,48768,49140,49056,49140,49128,49140,
+		48960,48960,48960,48996,48960,49116,49128,49140,49056,49056,49104,49140,49104,49140,49128,49140,
+		36864,36864,36864,36864,36864,36864,36864,36900,36864,36864,36864,36876,36864,36864,36864,36948,
+		36864,36864,36864,36864,36864,36864,36864,36948,36864,36864,36864,36900,36864,37020,37032,37236,
+		36864,36864,36864,36864,36864,36864,36864,36948,36864,36864,36864,36900,36864,36912,37032,43188,
+		36864,36864,36864,43020,36864,43008,43056,43380,43008,43200,43296,43764,43728,43764,43752,43764,
+		36864,36864,36864,36864,36864,36864,43008,43044,36864,43008,43008,43044,43008,43008,43080,43188,
+		43008,43008,43008,43020,43008,43008,43008,43092,43008,43008,43008,43380,43296,43356,43368,44532,
+		43008,43008,43008,43008,43008,43008,43008,43092,43008,43008,43008,44292,44160,44316,44520,44532,
+		43008,44160,44160,44388,44352,44400,44520,44532,44352,44448,44448,44532,44496,46068,46056,49140,
+		43008,43008,43008,43008,43008,43008,43008,43044,43008,43008,43008,43020,43008,43008,43056,43188,
+		43008,43008,43008,43020,43008,43008,43008,43092,43008,43008,43008,43332,43104,43356,43368,43380,
+		43008,43008,43008,43008,43008,43008,43008,43092,43008,43008,43008,44580,43008,44700,48168,48372,
+		43008,44544,44544,48228,48000,48192,48264,49140,48192,49056,49056,49140,49104,49140,49128,49140,
+		43008,43008,43008,44544,44544,47616,47616,47700,47616,47616,47616,48420,48384,48528,48552,48564,
+		47616,48384,48384,48396,48384,48384,48624,49140,48384,49056,49056,49140,49104,49140,49128,49140,
+		48384,48384,48384,48780,48768,48768,48768,48852,48768,48768,48768,49140,49056,49116,49128,49140,
+		48768,48960,48960,48996,48960,49116,49128,49140,49056,49056,49104,49140,49104,49140,49128,49140,
+		43008,43008,43008,43008,43008,43008,43008,43044,43008,43008,43008,43020,43008,46080,46128,46260,
+		43008,46080,46080,46080,46080,46080,46080,46164,46080,46080,46080,46212,46176,46428,46440,46452,
+		46080,46080,46080,46080,46080,46080,46080,46164,46080,46080,46080,46116,46080,46236,46248,46836,
+		46080,46080,46080,46116,46080,46656,46728,46836,46656,46752,46752,46836,46800,49140,49128,49140,
+		46080,46080,46080,46080,46080,46080,46080,46164,46080,46080,46080,46116,46080,46128,46248,48564,
+		46080,46080,46080,46092,46080,48384,48432,48756,48384,48576,48672,49140,49104,49140,49128,49140,
+		46080,48384,48384,48396,48384,48768,48768,48852,48768,48768,48768,49092,48864,49116,49128,49140,
+		48768,48960,48960,48996,48960,49104,49128,49140,49056,49056,49056,49140,49104,49140,49128,49140,
+		46080,46080,46080,47616,47616,47616,47616,47652,47616,47616,47616,47652,47616,47616,47688,47796,
+		47616,47616,47616,47628,47616,47616,47616,47700,47616,47616,47808,47988,47904,48756,49128,49140,
+		47616,47616,47616,47616,47616,47616,47616,48852,47616,48384,48768,48900,48768,49116,49128,49140,
+		48768,48768,48960,48996,48960,49008,49128,49140,48960,49056,49056,49140,49104,49140,49128,49140,
+		47616,48384,48384,48384,48384,48384,48384,48468,48384,48384,48384,48420,48384,48540,48936,49140,
+		48384,48384,48384,48804,48768,48960,49032,49140,48960,49056,49056,49140,49104,49140,49128,49140,
+		48768,48768,48768,48780,48768,48768,48768,49140,48768,48960,49056,49140,49056,49140,49128,49140,
+		48960,48960,48960,49092,48960,49116,49128,49140,49056,49056,49128,49140,49104,49140,49140,49140,
+	},
+	// PulseTriSaw_8580: bitmul 0.8, bitstrength 2.5, threshold 0.64
+	{
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,192,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		1536,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2304,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,768,852,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,384,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4680,
+		4608,4608,4608,4608,4608,4608,4608,4632,4608,4608,4608,4608,4608,4704,4752,4788,
+		5376,5376,5376,5376,5376,5376,5376,5400,5376,5376,5376,5376,5376,5376,5376,5460,
+		5760,5760,5760,5760,5760,5760,5760,5784,5952,5952,5952,5952,6048,6048,6096,6132,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,1536,1536,1536,1632,1680,1716,
+		2304,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2304,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,768,768,768,768,768,852,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,384,384,384,408,576,576,576,576,672,672,720,756,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9288,
+		9216,9216,9216,9216,9216,9216,9216,9240,9216,9216,9216,9216,9216,9216,9360,9396,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9300,
+		9216,9216,9216,9216,9216,9216,9216,9240,9216,9216,9408,9408,9504,9504,9552,9588,
+		10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10752,10824,
+		10752,10752,10752,10752,10752,10752,10752,10776,10752,10752,10752,10752,10752,10848,10896,10932,
+		11520,11520,11520,11520,11520,11520,11520,11544,11520,11520,11520,11520,11520,11520,11520,11604,
+		11904,11904,11904,11904,11904,11904,11904,11928,12096,12096,12096,12096,12192,12192,12240,12276,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		2304,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2304,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,768,768,768,852,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,384,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		3072,3072,3072,3072,3072,3072,3072,3096,3072,3072,3264,3264,3360,3360,3408,3444,
+		4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4608,4680,
+		4608,4608,4608,4608,4608,4608,4608,4632,4608,4608,4608,4608,4608,4704,4752,4788,
+		5376,5376,5376,5376,5376,5376,5376,5400,5376,5376,5376,5376,5376,5376,5376,5460,
+		5760,5760,5760,5760,5760,5760,5760,5784,5952,5952,5952,5952,6048,6048,6096,6132,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,96,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		1152,1152,1152,1152,1152,1152,1152,1176,1344,1344,1344,1344,1440,1440,1488,1524,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,384,408,576,576,576,576,672,672,720,756,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,192,192,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,1536,1536,1536,1536,1536,1560,1536,1536,1536,1536,1536,1632,1680,1716,
+		2304,2304,2304,2304,2304,2304,2304,2328,2304,2304,2304,2304,2304,2304,2304,2388,
+		2688,2688,2688,2688,2688,2688,2688,2712,2880,2880,2880,2880,2976,2976,3024,3060,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+		0,0,0,0,0,0,0,24,0,0,0,0,288,288,336,372,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+		0,0,0,0,0,0,0,24,0,0,0,0,0,0,144,180,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12864,12864,12864,12864,12960,12960,13008,13044,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12360,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12288,12432,12468,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12372,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12480,12576,12576,12624,12660,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12360,
+		12288,12288,12288,12288,12288,12288,12288,12312,12288,12288,12288,12288,12288,12384,12432,12468,
+		12288,12288,12288,12288,12288,12288,12288,12312,13056,13056,13056,13056,13056,13056,13056,13140,
+		13440,13440,13440,13440,13440,13440,13440,13464,13632,13632,13632,13632,13728,13728,13776,13812,
+		18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18504,
+		18432,18432,18432,18432,18432,18432,18432,18456,18432,18432,18432,18432,18432,18432,18576,18612,
+		18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18432,18516,
+		18432,18432,18432,18432,18432,18432,18432,18456,18432,18432,18432,18432,18720,18720,18768,18804,
+		43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43008,43080,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43008,43008,43152,43188,
+		43008,43008,43008,43008,43008,43008,43008,43032,43008,43008,43008,43008,43008,43008,43008,43092,
+		43008,43008,43008,43008,43392,43392,43392,43416,43584,43584,43584,43584,43680,43680,43728,43764,
+		46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46152,
+		46080,46080,46080,46080,46080,46080,46080,46104,46080,46080,46080,46080,46080,46080,46224,46260,
+		46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46080,46164,
+		46080,46080,46080,46080,46080,46080,46080,46104,46080,46080,46272,46272,46368,46368,46416,46452,
+		47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47616,47688,
+		47616,47616,47616,47616,47616,47616,47616,47640,47616,47616,47616,47616,47616,47712,47760,47796,
+		48384,48384,48384,48384,48384,48384,48384,48408,48384,48384,48384,48384,48384,48384,48384,48468,
+		48768,48768,48768,48768,48768,48768,48768,48792,48960,48960,48960,48960,49056,49056,49104,49140,
+	},
+};
+
+#endif
@@ -0,0 +1,136 @@
+/*
+* Re-entrant variant of the player API (see context.h).
+*
+* This is just a thin layer on top of the regular sidplayer.cpp API: since all
+* the emulator state is thread local, all that is needed here is to make sure
+* that a context is only ever used by the thread that owns it.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+
+#include "context.h"
+
+// API provided by sidplayer.cpp
+extern "C" uint32_t	loadSidFile(uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+								uint32_t sample_rate, char* filename, void* basic_ROM,
+								void* char_ROM, void* kernal_ROM);
+extern "C" uint32_t	playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize);
+extern "C" uint8_t	isInitTimeout();
+extern "C" int32_t	computeAudioSamples();
+extern "C" uint32_t	warpTo(uint32_t ms);
+extern "C" uint32_t	skipSilence(uint32_t max_ms);
+extern "C" char*	getSoundBuffer();
+extern "C" uint32_t	getSampleRate();
+extern "C" char**	getMusicInfo();
+extern "C" int		countSIDs();
+extern "C" uint8_t	envIsSID6581();
+extern "C" uint8_t	envSetSID6581(uint8_t is6581);
+extern "C" uint8_t	envIsNTSC();
+extern "C" uint8_t	envSetNTSC(uint8_t is_ntsc);
+
+
+struct EmulatorContext {
+	// nothing needed here: the actual state lives in the thread's emulator
+};
+
+// the context that owns the calling thread's emulator (if any)
+static THREAD_LOCAL EmulatorContext* _owner = 0;
+
+#define CHECK_OWNER(ctx, err_result) \
+	if (!(ctx) || ((ctx) != _owner)) { \
+		fprintf(stderr, "error: EmulatorContext used from a thread that does not own it\n"); \
+		return err_result; \
+	}
+
+EmulatorContext* ctxCreate() {
+	if (_owner) return 0;
+
+	_owner = new EmulatorContext();
+	return _owner;
+}
+
+void ctxDestroy(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, );
+
+	// the emulator's buffers stay allocated for the thread's next context
+	delete ctx;
+	_owner = 0;
+}
+
+uint32_t ctxLoadSidFile(EmulatorContext* ctx, uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+						uint32_t sample_rate, char* filename, void* basic_ROM,
+						void* char_ROM, void* kernal_ROM) {
+	CHECK_OWNER(ctx, 1);
+	return loadSidFile(is_mus, in_buffer, in_buf_size, sample_rate, filename, basic_ROM, char_ROM, kernal_ROM);
+}
+
+uint32_t ctxPlayTune(EmulatorContext* ctx, uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize) {
+	CHECK_OWNER(ctx, 1);
+	return playTune(selected_track, trace_sid, procBufSize);
+}
+
+uint8_t ctxIsInitTimeout(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return isInitTimeout();
+}
+
+int32_t ctxComputeAudioSamples(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, -1);
+	return computeAudioSamples();
+}
+
+uint32_t ctxWarpTo(EmulatorContext* ctx, uint32_t ms) {
+	CHECK_OWNER(ctx, 0);
+	return warpTo(ms);
+}
+
+uint32_t ctxSkipSilence(EmulatorContext* ctx, uint32_t max_ms) {
+	CHECK_OWNER(ctx, 0);
+	return skipSilence(max_ms);
+}
+
+int16_t* ctxGetSoundBuffer(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return (int16_t*)getSoundBuffer();
+}
+
+uint32_t ctxGetSampleRate(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return getSampleRate();
+}
+
+char** ctxGetMusicInfo(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return getMusicInfo();
+}
+
+int ctxCountSIDs(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return countSIDs();
+}
+
+uint8_t ctxIsSID6581(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return envIsSID6581();
+}
+
+uint8_t ctxSetSID6581(EmulatorContext* ctx, uint8_t is6581) {
+	CHECK_OWNER(ctx, 0);
+	return envSetSID6581(is6581);
+}
+
+uint8_t ctxIsNTSC(EmulatorContext* ctx) {
+	CHECK_OWNER(ctx, 0);
+	return envIsNTSC();
+}
+
+uint8_t ctxSetNTSC(EmulatorContext* ctx, uint8_t is_ntsc) {
+	CHECK_OWNER(ctx, 0);
+	return envSetNTSC(is_ntsc);
+}
@@ -0,0 +1,73 @@
+/*
+* Re-entrant variant of the player API (see sidplayer.cpp): allows to run
+* multiple emulator instances concurrently within the same process, e.g. one
+* per CPU core.
+*
+* The emulator's state is kept in thread local variables (see THREAD_LOCAL in
+* base.h), i.e. each thread implicitly owns one separate C64/SID machine. An
+* EmulatorContext is the explicit handle for the machine of the thread that
+* created it: it must only be used from that thread and each thread can own
+* at most one context at a time. Calls from other threads are rejected.
+*
+* The machine is reused by the next context created on the same thread, i.e.
+* a worker thread can play any number of songs without paying for the setup
+* of a new machine each time.
+*
+* WebSid (c) 2021 Jürgen Wothke
+* version 1.0
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_CONTEXT_H
+#define WEBSID_CONTEXT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "base.h"
+
+typedef struct EmulatorContext EmulatorContext;
+
+/**
+* Binds a new context to the calling thread.
+*
+* The context is pinned to that thread: it cannot be handed over to another
+* thread and all the ctx*() functions (including ctxDestroy()) must be called
+* from the creating thread.
+*
+* @return 0 if the calling thread already owns a context
+*/
+EmulatorContext* ctxCreate();
+void ctxDestroy(EmulatorContext* ctx);
+
+/*
+* Same semantics as the respective sidplayer.cpp functions: all of them fail
+* (1, -1, 0 resp. NULL) when used with a context that is not owned by the
+* calling thread.
+*/
+uint32_t ctxLoadSidFile(EmulatorContext* ctx, uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+						uint32_t sample_rate, char* filename, void* basic_ROM,
+						void* char_ROM, void* kernal_ROM);
+uint32_t ctxPlayTune(EmulatorContext* ctx, uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize);
+uint8_t ctxIsInitTimeout(EmulatorContext* ctx);
+int32_t ctxComputeAudioSamples(EmulatorContext* ctx);
+uint32_t ctxWarpTo(EmulatorContext* ctx, uint32_t ms);
+uint32_t ctxSkipSilence(EmulatorContext* ctx, uint32_t max_ms);
+int16_t* ctxGetSoundBuffer(EmulatorContext* ctx);
+uint32_t ctxGetSampleRate(EmulatorContext* ctx);
+
+char** ctxGetMusicInfo(EmulatorContext* ctx);
+int ctxCountSIDs(EmulatorContext* ctx);
+
+uint8_t ctxIsSID6581(EmulatorContext* ctx);
+uint8_t ctxSetSID6581(EmulatorContext* ctx, uint8_t is6581);
+uint8_t ctxIsNTSC(EmulatorContext* ctx);
+uint8_t ctxSetNTSC(EmulatorContext* ctx, uint8_t is_ntsc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -40,7 +40,7 @@ extern "C" {
 
 // the clocks used in the emulation do not usually match the used audio
 // output sample rate and fractional overflows are handled here:
-static double _sample_cycles;
+static THREAD_LOCAL double _sample_cycles;
 
 static void resetDefaults(uint32_t sample_rate, uint8_t is_rsid,
 							uint8_t is_ntsc, uint8_t is_compatible) {
@@ -58,10 +58,12 @@ static void resetDefaults(uint32_t sample_rate, uint8_t is_rsid,
 	_sample_cycles= 0;
 }
 
+static THREAD_LOCAL uint8_t _event_scheduler = 1;
+
 #ifdef TEST
 // ------------------ to run Wolfgang Lorenz's test-suite ---------------------
 
-extern uint8_t test_running;
+extern THREAD_LOCAL uint8_t test_running;
 
 void testInit(void)
 {
@@ -69,18 +71,57 @@ void testInit(void)
 	resetDefaults(44100, 1, 0, 1);
 }
 
+// failed tests may wait for a key press forever
+#define TEST_CYCLE_LIMIT 500000000
+	// cycles clocked in one go by the event scheduler (see sysClockEvents())
+#define TEST_CHUNK_CYCLES 37
+
 void Core::rsidRunTest() {
 	testInit();
 
 	// use same sequence as in runEmulation (just without generating sample output)
 	while(test_running) {
-		if(!sysClockTest()) {
+		if (_event_scheduler) {
+			sysClockEvents(TEST_CHUNK_CYCLES, 0);
+			if (!cpuIsValidPcPSID()) {
+				test_running= 0;
+			}
+		} else if(!sysClockTest()) {
+			test_running= 0;
+		}
+		if (sysCycles() >= TEST_CYCLE_LIMIT) {
 			test_running= 0;
 		}
 	}
 }
 #endif
 
+void Core::setEventScheduler(uint8_t on) {
+	_event_scheduler = on;
+}
+
+// emulate the cycles needed for the next output sample
+static inline void clockSample(double n, uint8_t is_opt) {
+	if (_event_scheduler) {
+		if (_sample_cycles < n) {
+			uint32_t cycles = (uint32_t)ceil(n - _sample_cycles);
+			sysClockEvents(cycles, is_opt);
+			_sample_cycles += cycles;
+		}
+	} else if (is_opt) {
+		while(_sample_cycles < n) {
+			sysClockOpt();
+			_sample_cycles++;
+		}
+	} else {
+		while(_sample_cycles < n) {
+			sysClock();
+			_sample_cycles++;
+		}
+	}
+	_sample_cycles -= n;	// keep overflow
+}
+
 void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 					int16_t** synth_trace_bufs, uint16_t samples_per_call) {
 
@@ -103,16 +144,11 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 
 		// most relevant case.. only one SID
 		for (int i= 0; i<samples_per_call; i++) {
-			while(_sample_cycles < n) {
+			// clocking used for "normal" songs". note: for a slow garbage song
+			// like Baroque_Music_64_BASIC the sysClockOpt()/SID::isAudible()  bring down
+			// the "silence detection" from 33 sec to 19 secs
 
-				// clocking used for "normal" songs". note: for a slow garbage song
-				// like Baroque_Music_64_BASIC the sysClockOpt()/SID::isAudible()  bring down
-				// the "silence detection" from 33 sec to 19 secs
-
-				sysClockOpt();
-				_sample_cycles++;
-			}
-			_sample_cycles -= n;	// keep overflow
+			clockSample(n, 1);
 
 			SID::synthSamplesSingleSID(synth_buffer, synth_trace_bufs, i);
 		}
@@ -123,11 +159,7 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 			// standard sid-file mode, for 2 and 3 SID configurations
 
 			for (int i= 0; i<samples_per_call; i++) {
-				while(_sample_cycles < n) {
-					sysClockOpt();
-					_sample_cycles++;
-				}
-				_sample_cycles -= n;	// keep overflow
+				clockSample(n, 1);
 
 				SID::synthSamplesMultiSID(synth_buffer, synth_trace_bufs, i);
 			}
@@ -137,11 +169,7 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 			// the "scope" handling here is stripped down to a less expensive impl)
 
 			for (int i= 0; i<samples_per_call; i++) {
-				while(_sample_cycles < n) {
-					sysClock();
-					_sample_cycles++;
-				}
-				_sample_cycles -= n;	// keep overflow
+				clockSample(n, 0);
 
 				SID::synthSamplesStrippedMultiSID(synth_buffer, synth_trace_bufs, i);
 			}
@@ -149,6 +177,66 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 	}
 }
 
+static THREAD_LOCAL struct PerfStats* _perf_stats = 0;
+
+void Core::setPerfStats(struct PerfStats* stats) {
+	_perf_stats = stats;
+}
+
+// same as clockSample but additionally returns the (estimated) time spent in SID::clockAll()
+static double clockSampleProfiled(double n, uint8_t is_opt) {
+	double sid_secs = 0;
+
+	if (_event_scheduler) {
+		if (_sample_cycles < n) {
+			uint32_t cycles = (uint32_t)ceil(n - _sample_cycles);
+			sid_secs = sysClockEventsProfiled(cycles, is_opt);
+			_sample_cycles += cycles;
+		}
+	} else {
+		while(_sample_cycles < n) {
+			sid_secs += sysClockProfiled(is_opt);
+			_sample_cycles++;
+		}
+	}
+	_sample_cycles -= n;	// keep overflow
+	return sid_secs;
+}
+
+// same as runEmulation but with time measurements (kept separate so that the
+// regular loops do not pay anything for it)
+void runEmulationProfiled(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
+					int16_t** synth_trace_bufs, uint16_t samples_per_call) {
+
+	double n= SID::getCyclesPerSample();
+
+	uint8_t sid_count = SID::getNumberUsedChips();
+	uint8_t is_opt = (sid_count == 1) || is_simple_sid_mode;
+
+	for (int i= 0; i<samples_per_call; i++) {
+		uint32_t cycles = sysCycles();
+		double start = sysTimeSecs();
+
+		_perf_stats->sid_clock_secs += clockSampleProfiled(n, is_opt);
+
+		double synth_start = sysTimeSecs();
+
+		if (sid_count == 1) {
+			SID::synthSamplesSingleSID(synth_buffer, synth_trace_bufs, i);
+		} else if (is_simple_sid_mode) {
+			SID::synthSamplesMultiSID(synth_buffer, synth_trace_bufs, i);
+		} else {
+			SID::synthSamplesStrippedMultiSID(synth_buffer, synth_trace_bufs, i);
+		}
+		double end = sysTimeSecs();
+
+		_perf_stats->sys_secs += synth_start - start;
+		_perf_stats->synth_secs += end - synth_start;
+		_perf_stats->cycles += sysCycles() - cycles;
+		_perf_stats->samples++;
+	}
+}
+
 // XXX bad API design.. the batch size is actually controlled by samples_per_call and it may
 // result in more or less than "one frame". the below 1x per frame hacks obviously will not work anymore..
 uint8_t Core::runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, int16_t* synth_buffer,
@@ -158,11 +246,38 @@ uint8_t Core::runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, int16_t* sy
 
 	ciaUpdateTOD(speed); // hack: TOD is rarely used so there is no point to do it more precisely
 
-	runEmulation(is_simple_sid_mode, synth_buffer, synth_trace_bufs, samples_per_call);
-
+	if (_perf_stats) {
+		runEmulationProfiled(is_simple_sid_mode, synth_buffer, synth_trace_bufs, samples_per_call);
+	} else {
+		runEmulation(is_simple_sid_mode, synth_buffer, synth_trace_bufs, samples_per_call);
+	}
 	return 0;
 }
 
+void Core::updateTOD(uint8_t speed) {
+	ciaUpdateTOD(speed);
+}
+
+uint16_t Core::warpOneFrame(uint8_t is_simple_sid_mode, uint16_t samples_per_call,
+								uint8_t until_audible) {
+
+	if (until_audible && SID::isAudible()) return 0;
+
+	SID::resetGlobalStatistics();
+
+	double n= SID::getCyclesPerSample();
+	uint8_t is_opt = (SID::getNumberUsedChips() == 1) || is_simple_sid_mode;	// see runEmulation()
+
+	// the SID's output is only calculated at sample boundaries (see synthSample*)
+	// and skipping that does not change the state of the emulated machine
+	for (uint16_t i= 0; i<samples_per_call; i++) {
+		clockSample(n, is_opt);
+
+		if (until_audible && SID::isAudible()) return i + 1;
+	}
+	return samples_per_call;
+}
+
 void Core::loadSongBinary(uint8_t* src, uint16_t dest_addr, uint16_t len, uint8_t basic_mode) {
 	memCopyToRAM(src, dest_addr, len);
 
@@ -218,7 +333,7 @@ uint8_t runInitPSID(uint16_t init_addr, uint8_t selected_track) {
 	return 1;
 }
 
-void Core::startupTune(uint32_t sample_rate, uint8_t selected_track,
+uint8_t Core::startupTune(uint32_t sample_rate, uint8_t selected_track,
 						uint8_t is_rsid, uint8_t is_timer_driven_psid, uint8_t is_ntsc,
 						uint8_t is_compatible, uint8_t basic_mode,
 						uint16_t free_space, uint16_t* init_addr, uint16_t load_end_addr,
@@ -233,7 +348,7 @@ void Core::startupTune(uint32_t sample_rate, uint8_t selected_track,
 
 	if (!is_rsid) {
 
-		if (!runInitPSID((*init_addr), selected_track)) return;
+		if (!runInitPSID((*init_addr), selected_track)) return 0;
 
 		uint16_t main = memPsidMain(free_space, play_addr);
 		cpuSetProgramCounterPSID(main);	// just install an endless loop for main
@@ -247,4 +362,5 @@ void Core::startupTune(uint32_t sample_rate, uint8_t selected_track,
 		sysReset();
 		cpuSetProgramCounter((*init_addr), selected_track);
 	}
+	return 1;
 }
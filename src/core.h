@@ -13,6 +13,17 @@
 #include "base.h"
 
 
+/**
+* Time measurements collected while enabled via Core::setPerfStats().
+*/
+struct PerfStats {
+	double		sys_secs;		// sysClockEvents() or sysClockOpt()/sysClock() (including SID::clockAll)
+	double		sid_clock_secs;	// estimated share of SID::clockAll within sys_secs
+	double		synth_secs;		// SID::synthSamples*()
+	uint32_t	cycles;
+	uint32_t	samples;
+};
+
 class Core {
 public:
 	// load the C64 program data into the emulator (just the binary 
@@ -20,8 +31,9 @@ public:
 	static void loadSongBinary(uint8_t* src, uint16_t dest_addr, uint16_t len, 
 								uint8_t basic_mode);
 
-	// then the emulation can be initiated
-	static void startupTune(uint32_t sample_rate, uint8_t selected_track, uint8_t is_rsid, uint8_t is_timer_driven_psid, 
+	// then the emulation can be initiated (returns 0 if a PSID's INIT
+	// routine did not return within the cycle limit, see CYCLELIMIT)
+	static uint8_t startupTune(uint32_t sample_rate, uint8_t selected_track, uint8_t is_rsid, uint8_t is_timer_driven_psid, 
 							uint8_t is_ntsc, uint8_t is_compatible, uint8_t basic_mode, 
 							uint16_t free_space, uint16_t* init_addr, uint16_t load_end_addr, 
 							uint16_t play_addr);
@@ -30,8 +42,27 @@ public:
 	// and return the respective audio output
 	static uint8_t runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, int16_t* synth_buffer, 
 								int16_t** synth_trace_bufs, uint16_t samples_per_call);
+
+	// same as runOneFrame but without any audio/trace output, i.e. only the
+	// emulation of the machine is performed (used for fast forwarding). If
+	// until_audible is set then the emulation stops as soon as the SID becomes
+	// audible. Returns the number of emulated samples. Unlike runOneFrame this
+	// does not advance the TOD clocks since a warp may end anywhere within a
+	// frame (the caller is responsible for that, see updateTOD).
+	static uint16_t warpOneFrame(uint8_t is_simple_sid_mode, uint16_t samples_per_call,
+								uint8_t until_audible);
+
+	// advance the TOD clocks by one frame (this is done by runOneFrame)
+	static void updateTOD(uint8_t speed);
 	
 	static void callKernalROMReset();
+
+	// benchmark support: enables time measurements in runOneFrame (use 0 to disable)
+	static void setPerfStats(struct PerfStats* stats);
+
+	// switch between the event driven (default) and the original cycle-by-cycle
+	// clocking of the system components (see sysClockEvents())
+	static void setEventScheduler(uint8_t on);
 	
 #ifdef TEST
 	static void rsidRunTest();
@@ -69,10 +69,13 @@
 */
 
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 
 #ifdef EMSCRIPTEN
 #include <emscripten.h>
+#else
+#include <pthread.h>	// pthread_once (see initOpDescriptors)
 #endif
 
 #include "cpu.h"
@@ -156,10 +159,46 @@
 
 // required lead time in cycles before IRQ can trigger
 #define IRQ_LEAD_DEFAULT 2
-static uint8_t _interrupt_lead_time = IRQ_LEAD_DEFAULT;
+static THREAD_LOCAL uint8_t _interrupt_lead_time = IRQ_LEAD_DEFAULT;
+
+static THREAD_LOCAL uint8_t _irq_committed = 0;	// CPU is committed to running the IRQ
+static THREAD_LOCAL uint32_t _irq_line_ts = 0;
+
+// Performance optimization: instead of the CPU polling the VIC and CIA chips
+// in each cycle, the chips push each change of their interrupt output to the
+// CPU (see cpuSetIRQLine()/cpuSetNMILine()).
+static THREAD_LOCAL uint8_t _irq_sources = 0;	// IRQ_SRC_* of the chips that currently pull the IRQ line
+static THREAD_LOCAL uint8_t _nmi_signal = 0;		// CIA 2 currently pulls the NMI line
+
+#define IRQ_SIGNALED() \
+	_irq_sources
+
+#define NMI_SIGNALED() \
+	_nmi_signal
+
+// Performance optimization: the outcome of CHECK_FOR_IRQ()/CHECK_FOR_NMI() only
+// changes when one of their inputs changes, i.e. an interrupt line or the CPU's
+// own state (I flag, current instruction). The checks therefore are only
+// performed in the first CPU cycle after such a change, which yields the same
+// line timestamps as a check in every cycle. Whether an interrupt is run is
+// then decided when the next instruction is fetched: the required lead time
+// (see IS_IRQ_PENDING()) corresponds to the line having been seen by the
+// second-to-last cycle of the previous instruction.
+static THREAD_LOCAL uint8_t _int_check = 1;		// inputs of the checks have changed
+
+void cpuSetIRQLine(uint8_t source, uint8_t on) {
+	if (on) {
+		_irq_sources |= source;
+	} else {
+		_irq_sources &= ~source;
+	}
+	_int_check = 1;
+}
 
-static uint8_t _irq_committed = 0;	// CPU is committed to running the IRQ
-static uint32_t _irq_line_ts = 0;
+void cpuSetNMILine(uint8_t on) {
+	_nmi_signal = on;
+	_int_check = 1;
+}
 
 // required special handling for SEI operation: on the real hardware the operation
 // would block interrupts in its 2nd cycle but not the 1st. And due the special
@@ -183,7 +222,7 @@ typedef enum {
 	SLIPPED_SEI = 2
 } slip_status_t;
 
-slip_status_t _slip_status;
+THREAD_LOCAL slip_status_t _slip_status;
 
 #define COMMIT_TO_IRQ() \
 	if (!_irq_line_ts) { \
@@ -191,12 +230,10 @@ slip_status_t _slip_status;
 		_irq_line_ts = SYS_CYCLES();	/* ts when line was activated */ \
 	}
 
-// todo: correctly the IRQ check should be performed 1x, at the right moment,
-// within each executed command! i.e. the number of checks could be reduced by
-// a factor of 2-4! also that would avoid having to do post mortem analysis of
-// what may or may not have happened before - hence avoiding all the delay
-// calculations used below... it would also automatically handle the case of
-// a stunned CPU
+// note: the check is only performed when its inputs have changed (see
+// _int_check) and the timestamp taken here then is compared against the
+// instruction's polling point when the next instruction is fetched (see
+// IS_IRQ_PENDING())
 
 // note: on the real HW the respective check happends in 2 phase of the
 // previous CPU cycle and the respective internal interrupt signal then goes
@@ -205,7 +242,7 @@ slip_status_t _slip_status;
 // that has just happend in the 1 phase)
 
 #define CHECK_FOR_IRQ() \
-	if ( vicIRQ() || ciaIRQ() ) { \
+	if (IRQ_SIGNALED()) { \
 		if (_no_flag_i) { /* this will also let pass the 1st cycle of a SEI */\
 			COMMIT_TO_IRQ(); \
 		} else if (_exe_instr_opcode == SEI_OP) { \
@@ -234,9 +271,9 @@ slip_status_t _slip_status;
 
 	// ---- NMI handling ---
 
-static uint8_t _nmi_committed = 0;		// CPU is committed to running the NMI
-static uint8_t _nmi_line = 0;			// state change detection
-static uint32_t _nmi_line_ts = 0;		// for scheduling
+static THREAD_LOCAL uint8_t _nmi_committed = 0;		// CPU is committed to running the NMI
+static THREAD_LOCAL uint8_t _nmi_line = 0;			// state change detection
+static THREAD_LOCAL uint32_t _nmi_line_ts = 0;		// for scheduling
 
 
 // when the CPU detects the "NMI line" activation it "commits" to
@@ -247,7 +284,7 @@ static uint32_t _nmi_line_ts = 0;		// for scheduling
 // the NMI line is immediately acknowledged/cleared in the same
 // cycle that the CIA sets it, the NMI handler should still be called.
 #define CHECK_FOR_NMI() \
-	if (ciaNMI() && (_no_nmi_hack || _no_flag_i)) {	/* NMI line is active now */\
+	if (NMI_SIGNALED() && (_no_nmi_hack || _no_flag_i)) {	/* NMI line is active now */\
 	\
 		/* NMI is different from IRQ in that only the transition from \
 		   high to low signal triggers an NMI, and the line has to be \
@@ -319,10 +356,10 @@ static const int32_t _opbase_write_cycle[256] = {
 
 
 // instruction that is executing in a "cycle-by-cycle manner"
-static int16_t _exe_instr_opcode;
-static int8_t _exe_instr_cycles;
-static int8_t _exe_instr_cycles_remain;
-static int8_t _exe_write_trigger;
+THREAD_LOCAL int16_t _exe_instr_opcode;	// see CPU_IS_FETCHING()
+static THREAD_LOCAL int8_t _exe_instr_cycles;
+static THREAD_LOCAL int8_t _exe_instr_cycles_remain;
+static THREAD_LOCAL int8_t _exe_write_trigger;
 
 
 #include "cpu_operations.inc"	/* prefetchOperation & runPrefetchedOp */
@@ -348,12 +385,12 @@ static int8_t _exe_write_trigger;
 */
 #define CHECK_FOR_VIC_STUN(is_stunned) \
 	/* VIC badline handling (i.e. CPU may be paused/stunned) */ \
-	uint8_t stun_mode = vicStunCPU();	/* it won't hurt to also STUN the crappy PSID songs */ \
+	uint8_t stun_mode = VIC_STUN_CPU();	/* it won't hurt to also STUN the crappy PSID songs */ \
 	if (stun_mode) { \
 		if ((stun_mode == 2) || (_exe_instr_opcode < 0)) { \
 			is_stunned = 1; \
 		} else { \
-			uint8_t bus_write = _opbase_write_cycle[_exe_instr_opcode]; \
+			uint8_t bus_write = _op_desc[_exe_instr_opcode].bus_write; \
 			if (bus_write) { \
 				/* this OP may be allowed to still perform "bus write" (if that's the current step): */ \
 				int8_t p = _exe_instr_cycles -_exe_instr_cycles_remain; \
@@ -373,14 +410,17 @@ static int8_t _exe_write_trigger;
 
 
 // cpuClock function pointer
-void (*cpuClock)();
+THREAD_LOCAL void (*cpuClock)();
 
 /*
 * Simulates what the CPU does within the next system clock cycle.
 */
-static void cpuClockRSID() {
-	CHECK_FOR_IRQ();	// check 1st (so NMI can overrule if needed)
-	CHECK_FOR_NMI();
+void cpuClockRSID() {
+	if (_int_check) {
+		_int_check = 0;
+		CHECK_FOR_IRQ();	// check 1st (so NMI can overrule if needed)
+		CHECK_FOR_NMI();
+	}
 
 	uint8_t is_stunned;
 	CHECK_FOR_VIC_STUN(is_stunned);		// todo: check if some processing could be saved checking this 1st
@@ -409,6 +449,7 @@ static void cpuClockRSID() {
 		}
 		// since there are no 1-cycle ops nothing else needs to be done right now
 		_exe_instr_cycles_remain =  _exe_instr_cycles - 1;	// we already are in 1st cycle here
+		_int_check = 1;
 	} else {
 
 		// handle "current" instruction
@@ -417,6 +458,7 @@ static void cpuClockRSID() {
 		if(_exe_instr_cycles_remain == _exe_write_trigger) {
 			// output results of current instruction (may be before op ends)
 			runPrefetchedOp();
+			_int_check = 1;
 		}
 		if(_exe_instr_cycles_remain == 0) {
 			// current operation has been completed.. get something new to do in the next cycle
@@ -425,11 +467,14 @@ static void cpuClockRSID() {
 	}
 }
 
-static void cpuClockPSID() {
+void cpuClockPSID() {
 	// optimization: this is a 1:1 copy of the regular cpuClock() with all the
 	// NMI handling thrown out (tested songs ran about 5% faster with this optimization)
 
-	CHECK_FOR_IRQ();	// check 1st (so NMI can overrule if needed)
+	if (_int_check) {
+		_int_check = 0;
+		CHECK_FOR_IRQ();
+	}
 
 	/* if a PSID depends on badline timing then by definition it MUST be an RSID!
 	uint8_t is_stunned;
@@ -449,6 +494,7 @@ static void cpuClockPSID() {
 		}
 		// since there are no 1-cycle ops nothing else needs to be done right now
 		_exe_instr_cycles_remain =  _exe_instr_cycles - 1;	// we already are in 1st cycle here
+		_int_check = 1;
 	} else {
 
 		// handle "current" instruction
@@ -457,6 +503,7 @@ static void cpuClockPSID() {
 		if(_exe_instr_cycles_remain == _exe_write_trigger) {
 			// output results of current instruction (may be before op ends)
 			runPrefetchedOp();
+			_int_check = 1;
 		}
 		if(_exe_instr_cycles_remain == 0) {
 			// current operation has been completed.. get something new to do in the next cycle
@@ -465,9 +512,507 @@ static void cpuClockPSID() {
 	}
 }
 
+// event scheduling (see sysClockEvents()): while an instruction is in
+// progress the CPU just counts down the remaining cycles until the cycle
+// that actually runs the operation (see _exe_write_trigger) - unless a
+// not yet registered IRQ/NMI must be handled
+uint32_t cpuCyclesToEvent() {
+	if (_exe_instr_opcode < 0) return 1;	// next instruction is fetched
+
+	uint32_t e = _exe_instr_cycles_remain;
+	if ((_exe_write_trigger > 0) && (_exe_write_trigger < _exe_instr_cycles_remain)) {
+		e -= _exe_write_trigger;
+	}
+	// skipping a single cycle costs more than just running it
+	if (e <= 2) return 1;
+
+	// see CHECK_FOR_IRQ()/CHECK_FOR_NMI(): timestamps are taken in the
+	// 1st cycle that the CPU sees the respective signal
+	if (!_irq_line_ts && _no_flag_i && IRQ_SIGNALED()) return 1;
+	if (!_nmi_line && NMI_SIGNALED() && (_no_nmi_hack || _no_flag_i)) return 1;
+
+	// note: VIC stuns are covered by vicCyclesToEvent()
+	return e;
+}
+
+void cpuSkip(uint32_t cycles) {
+	_exe_instr_cycles_remain -= cycles;
+}
+
+
+// ---- hot-spot profiling ---
+
+// The profiling is implemented as a wrapper around the regular cpuClock
+// implementation, i.e. it has no impact when it is not used. The block cache
+// is not used while profiling: each instruction must go through the
+// wrapper (the emulation result is the same).
+
+static THREAD_LOCAL struct CpuProfile* _profile = 0;
+static THREAD_LOCAL void (*_profiled_clock)() = 0;
+static THREAD_LOCAL int32_t _profiled_pc = -1;	// start of the current instruction (-1 = interrupt entry)
+
+static void cpuClockProfiled() {
+	const int16_t opcode = _exe_instr_opcode;
+	const int8_t remain = _exe_instr_cycles_remain;
+
+	_profiled_clock();
+
+	if (opcode < 0) {
+		if (_exe_instr_opcode < 0) {
+			// stunned before the next instruction could be fetched
+			_profile->stun_cycles++;
+			_profile->pc_cycles[_pc]++;
+		} else {
+			const uint8_t opc = _exe_instr_opcode;
+			_profile->op_cycles[opc] += _exe_instr_cycles;
+			_profile->op_count[opc]++;
+
+			if (opc == START_IRQ_OP) {
+				_profile->irq_count++;
+				_profiled_pc = -1;
+			} else if (opc == START_NMI_OP) {
+				_profile->nmi_count++;
+				_profiled_pc = -1;
+			} else {
+				const uint16_t pc = _pc - 1;	// prefetch already skipped the opcode
+				_profile->pc_cycles[pc] += _exe_instr_cycles;
+				_profile->pc_count[pc]++;
+				_profile->pc_opcode[pc] = opc;
+				_profiled_pc = pc;
+			}
+		}
+	} else if ((opcode == _exe_instr_opcode) && (remain == _exe_instr_cycles_remain)) {
+		// stunned in the middle of the instruction
+		_profile->stun_cycles++;
+		_profile->op_cycles[opcode]++;
+		if (_profiled_pc >= 0) _profile->pc_cycles[_profiled_pc]++;
+	}
+}
+
+static void wrapClock() {
+	if (cpuClock && (cpuClock != &cpuClockProfiled)) {
+		_profiled_clock = cpuClock;
+		cpuClock = &cpuClockProfiled;
+	}
+}
+
+void cpuEnableProfile(uint8_t on) {
+	if (on) {
+		if (!_profile) _profile = (struct CpuProfile*)malloc(sizeof(struct CpuProfile));
+		memset(_profile, 0, sizeof(struct CpuProfile));
+		_profiled_pc = -1;
+		wrapClock();
+	} else {
+		if (cpuClock == &cpuClockProfiled) cpuClock = _profiled_clock;
+		free(_profile);
+		_profile = 0;
+	}
+}
+
+const struct CpuProfile* cpuGetProfile() {
+	return _profile;
+}
+
+
+// ---- block cache ---
+
+// Performance optimization: players run the same straight-line code sequences
+// over and over again. A sequence that can neither access the IO area nor
+// change the interrupt handling (i.e. it can neither affect the other chips
+// nor be affected by them) is identified once and cached as a "block". While
+// VIC and CIA are idle (see sysClockEvents()) the CPU can then run a complete
+// block in one step, i.e. without the cycle-by-cycle handling of each of its
+// instructions. The end result is exactly the same.
+
+// Cached blocks are invalidated when their code is overwritten (self-modifying
+// players are common) or when the memory banking changes.
+
+#define BLOCK_MAX_OPS		16		// must fit into "check_addr" mask
+#define BLOCK_CACHE_SIZE	1024	// must be a power of 2
+
+#define IS_IO_ADDR(addr) \
+	(((addr) & 0xf000) == 0xd000)
+
+struct CodeBlock {
+	uint16_t pc;			// start address of the block
+	uint8_t is_valid;
+	uint8_t bank;			// memory banking that the code was decoded with
+	uint8_t ops;			// number of instructions (0 = no block can be run at this address)
+	uint8_t cycles;			// worst case duration of the complete block
+	uint8_t is_loop;		// the block loops back to its start without writing to memory
+	uint8_t stub;			// see STUB_* (the block is run natively)
+	uint16_t check_addr;	// bit n: instruction n uses an indirect address that must be checked
+	uint32_t version[2];	// see memPageVersion() of the 2 pages that the code may use
+};
+
+static THREAD_LOCAL struct CodeBlock _blocks[BLOCK_CACHE_SIZE];
+
+static void flushBlocks() {
+	for (uint32_t i = 0; i < BLOCK_CACHE_SIZE; i++) {
+		_blocks[i].is_valid = 0;
+	}
+}
+
+#define CURRENT_BANK() \
+	(MEM_READ_RAM(0x0001) & 0x7)
+
+#define IS_BLOCK_OUTDATED(block, page) \
+	((block->version[0] != MEM_PAGE_VERSION(page)) || \
+	 (block->version[1] != MEM_PAGE_VERSION((uint8_t)((page) + 1))))
+
+// ---- KERNAL stubs ---
+
+// Performance optimization: songs that do not bring their own ROM use the small
+// replacement routines that are installed in the KERNAL area (see memory.c), e.g.
+// IRQ handlers enter via $FF48 and commonly leave via $EA31/$EA81. These are
+// recognized by their code, i.e. also when copied into RAM - and routines that
+// a song has patched or replaced are just interpreted. A recognized routine is
+// handled like a block (i.e. only while VIC and CIA are idle) but its effects
+// are applied directly and it is charged the exact cycles of the original code.
+
+#define STUB_NONE		0
+#define STUB_IRQ_ENTRY	1	// $ff48: save registers, check BRK flag, JMP ($0314)
+#define STUB_IRQ_EXIT	2	// $ea31-$ea7d: NOPs, reset $01 banking, INC $a2 (the following LDA $DC0D is interpreted)
+
+#define STUB_IRQ_ENTRY_ADDR		0xff48
+#define STUB_IRQ_NOPS_ADDR		0xea31
+#define STUB_IRQ_EXIT_ADDR		0xea75
+#define STUB_IRQ_EXIT_END		0xea7e	// LDA $DC0D
+
+static const uint8_t _stub_irq_entry[19] = {0x48,0x8A,0x48,0x98,0x48,0xBA,0xBD,0x04,0x01,0x29,0x10,0xF0,0x03,0xEA,0xEA,0xEA,0x6C,0x14,0x03};
+static const uint8_t _stub_irq_exit[9] = {0xa5,0x01,0x29,0x1f,0x85,0x01,0xE6,0xA2,0xEA};	// preceeded by NOPs from $ea31
+
+static uint8_t isCode(uint16_t pc, const uint8_t* code, uint8_t len) {
+	for (uint8_t i = 0; i < len; i++) {
+		if (memGet(pc + i) != code[i]) return 0;
+	}
+	return 1;
+}
+
+// cycles of the straight-line code between pc and end (without any timing adjustments)
+static uint32_t codeCycles(uint16_t pc, uint16_t end) {
+	uint32_t cycles = 0;
+	while (pc < end) {
+		const struct OpDesc* desc = &_op_desc[memGet(pc)];
+		cycles += desc->cycles;
+
+		switch (desc->mode) {
+			case abs:
+			case abx:
+			case aby:
+			case ind:
+				pc += 3;
+				break;
+			case imp:
+			case acc:
+				pc += 1;
+				break;
+			default:
+				pc += 2;
+				break;
+		}
+	}
+	return cycles;
+}
+
+static uint8_t decodeStub(struct CodeBlock* block, uint16_t pc) {
+	if (pc == STUB_IRQ_ENTRY_ADDR) {
+		if (!isCode(pc, _stub_irq_entry, sizeof(_stub_irq_entry))) return 0;
+
+		block->stub = STUB_IRQ_ENTRY;
+		block->cycles = codeCycles(pc, pc + sizeof(_stub_irq_entry)) + 1;	// worst case: LDA $0104,X crosses page
+
+	} else if ((pc >= STUB_IRQ_NOPS_ADDR) && (pc <= STUB_IRQ_EXIT_ADDR)) {
+		for (uint16_t a = pc; a < STUB_IRQ_EXIT_ADDR; a++) {
+			if (memGet(a) != 0xea) return 0;
+		}
+		if (!isCode(STUB_IRQ_EXIT_ADDR, _stub_irq_exit, sizeof(_stub_irq_exit))) return 0;
+
+		block->stub = STUB_IRQ_EXIT;
+		block->cycles = codeCycles(pc, STUB_IRQ_EXIT_END);
+	} else {
+		return 0;
+	}
+	block->ops = 1;	// i.e. "can be run"
+	return 1;
+}
+
+// same end result as interpreting the respective stub
+static uint32_t runStub(const struct CodeBlock* block) {
+	uint32_t cycles = block->cycles;
+
+	if (block->stub == STUB_IRQ_ENTRY) {
+		push(_a);
+		push(_x);
+		push(_y);
+		_x = _s;
+		if (_x < 0xfc) cycles--;	// LDA $0104,X does not cross the page
+
+		_a = memGet(0x0104 + _x) & FLAG_B0;	// was it a BRK?
+		SETFLAGS(FLAG_Z, !_a);
+		SETFLAGS(FLAG_N, 0);
+
+		if (!_a) {
+			// BEQ is taken (same page) and skips the NOPs of the disabled BRK handling
+			cycles = cycles + 1 - 3 * _op_desc[0xea].cycles;
+		}
+		_pc = memGet(0x0314) | (memGet(0x0315) << 8);
+
+	} else {	// STUB_IRQ_EXIT
+		_a = memGet(0x0001) & 0x1f;
+		memSet(0x0001, _a);
+		memSet(0x00a2, memGet(0x00a2) + 1);
+		SETFLAGS(FLAG_Z, !memGet(0x00a2));
+		SETFLAGS(FLAG_N, memGet(0x00a2) & 0x80);
+
+		// the CIA 1 ICR must be read (i.e. acknowledged) in the correct cycle, i.e. that
+		// LDA $DC0D is left to the regular cycle-by-cycle handling
+		_pc = STUB_IRQ_EXIT_END;
+	}
+	_interrupt_lead_time = IRQ_LEAD_DEFAULT;	// same as for the last instruction
+	return cycles;
+}
+
+// determines the longest sequence of instructions that can be used as a block
+static void decodeBlock(struct CodeBlock* block, uint16_t pc, uint8_t bank) {
+	const uint8_t page = pc >> 8;
+
+	block->pc = pc;
+	block->is_valid = 1;
+	block->bank = bank;
+	block->ops = block->cycles = block->is_loop = 0;
+	block->stub = STUB_NONE;
+	block->check_addr = 0;
+
+	uint8_t is_pure = 1;	// no memory writes
+
+	// all the instructions of a block fit into 2 pages (max 48 bytes)
+	block->version[0] = memWatchPage(page);
+	block->version[1] = memWatchPage(page + 1);
+
+	if (decodeStub(block, pc)) return;
+
+	while (block->ops < BLOCK_MAX_OPS) {
+		if (IS_IO_ADDR(pc) || IS_IO_ADDR((uint16_t)(pc + 2))) return;
+
+		const struct OpDesc* desc = &_op_desc[memGet(pc)];
+		uint16_t ad = memGet(pc + 1) | (memGet(pc + 2) << 8);
+		uint8_t len;
+
+		switch (desc->mnemonic) {
+			// everything that may change the interrupt handling
+			case brk:
+			case cli:
+			case jam:
+			case plp:
+			case rti:
+			case sei:
+			case sti:
+			case stn:
+			// obscure illegal ops
+			case sha:
+			case shs:
+			case shx:
+			case shy:
+				return;
+			default:
+				break;
+		}
+
+		switch (desc->mode) {
+			case abs:
+				if ((desc->mnemonic != jmp) && (desc->mnemonic != jsr) && IS_IO_ADDR(ad)) return;
+				len = 3;
+				break;
+			case ind:
+				if (IS_IO_ADDR(ad)) return;	// JMP's vector
+				len = 3;
+				break;
+			case abx:
+			case aby:
+				if ((ad <= 0xdfff) && (ad + 0xff >= 0xd000)) return;	// any index might be used
+				len = 3;
+				break;
+			case idx:
+			case idy:
+				block->check_addr |= 1 << block->ops;	// address only known at runtime
+				len = 2;
+				break;
+			case imp:
+			case acc:
+				len = 1;
+				break;
+			default:	// imm, rel & zero page
+				len = 2;
+				break;
+		}
+
+		block->ops++;
+		block->cycles += desc->cycles + ((desc->timing == TIMING_BRANCH) ? 2 : (desc->timing == TIMING_PAGE_CROSS));
+
+		switch (desc->mnemonic) {
+			// a block ends with the first operation that may change the control flow
+			case bcc:
+			case bcs:
+			case beq:
+			case bmi:
+			case bne:
+			case bpl:
+			case bvc:
+			case bvs:
+				block->is_loop = is_pure && ((uint16_t)(pc + 2 + (int8_t)(ad & 0xff)) == block->pc);
+				return;
+			case jmp:
+				block->is_loop = is_pure && (desc->mode == abs) && (ad == block->pc);
+				return;
+			case jsr:
+			case rts:
+				return;
+
+			case asl:
+			case lsr:
+			case rol:
+			case ror:
+				if (desc->mode == acc) break;
+			case dcp:
+			case dec:
+			case inc:
+			case isb:
+			case pha:
+			case php:
+			case rla:
+			case rra:
+			case sax:
+			case slo:
+			case sre:
+			case sta:
+			case stx:
+			case sty:
+				is_pure = 0;
+				break;
+			default:
+				break;
+		}
+		pc += len;
+	}
+}
+
+static struct CodeBlock* getBlock(uint16_t pc) {
+	struct CodeBlock* block = &_blocks[pc & (BLOCK_CACHE_SIZE - 1)];
+	const uint8_t bank = CURRENT_BANK();
+
+	if (!block->is_valid || (block->pc != pc) || (block->bank != bank) || IS_BLOCK_OUTDATED(block, pc >> 8)) {
+		decodeBlock(block, pc, bank);
+	}
+	return block;
+}
+
+// checks if the address used by the "idx" or "idy" instruction at _pc is in the IO area
+static uint8_t isIndirectAddrIO() {
+	const int32_t mode = _op_desc[memGet(_pc)].mode;
+	uint16_t ad = memGet(_pc + 1);
+
+	if (mode == idx) ad = (ad + _x) & 0xff;
+	ad = memGet(ad) | (memGet((ad + 1) & 0xff) << 8);
+	if (mode == idy) ad += _y;
+
+	return IS_IO_ADDR(ad);
+}
+
+// the CPU's per-cycle interrupt checks (see CHECK_FOR_IRQ(), CHECK_FOR_NMI(),
+// CHECK_FOR_VIC_STUN()) must not have any effect during the cycles of a block
+static uint8_t isInterruptQuiet() {
+	if (_irq_committed || (_no_flag_i && IRQ_SIGNALED())) return 0;
+
+	if (cpuClock == &cpuClockRSID) {
+		if (_nmi_committed || VIC_STUN_CPU()) return 0;
+		if (!_nmi_line && NMI_SIGNALED() && (_no_nmi_hack || _no_flag_i)) return 0;
+	}
+	return 1;
+}
+
+uint32_t cpuBlockCycles() {
+	if ((_exe_instr_opcode >= 0) || _profile || !isInterruptQuiet()) return 0;
+
+	struct CodeBlock* block = getBlock(_pc);
+	return block->ops ? block->cycles : 0;
+}
+
+static uint32_t blocksDone(uint32_t used) {
+	if (used) {
+		// same end result as the interrupt checks of the skipped cycles
+		if (!_irq_committed) _irq_line_ts = 0;
+
+		if ((cpuClock == &cpuClockRSID) && !(NMI_SIGNALED() && (_no_nmi_hack || _no_flag_i))) {
+			_nmi_line = 0;
+			_nmi_line_ts = 0;
+		}
+		_int_check = 1;
+	}
+	return used;
+}
+
+uint32_t cpuRunBlocks(uint32_t cycles) {
+	// precondition: cpuBlockCycles() <= cycles
+	uint32_t used = 0;
+
+	while (1) {
+		struct CodeBlock* block = getBlock(_pc);
+		if (!block->ops || (block->cycles > (cycles - used))) break;
+
+		if (block->stub) {
+			used += runStub(block);
+			if (block->stub == STUB_IRQ_EXIT) break;	// followed by the IO access
+			continue;
+		}
+
+		const uint8_t page = _pc >> 8;
+		const uint8_t a = _a, x = _x, y = _y, p = _p, s = _s;
+		const uint32_t start = used;
+
+		uint8_t i;
+		for (i = 0; i < block->ops; i++) {
+			if (((block->check_addr >> i) & 0x1) && isIndirectAddrIO()) {
+				return blocksDone(used);	// must be run cycle-by-cycle
+			}
+
+			prefetchOperation( &_exe_instr_opcode, &_exe_instr_cycles, &_interrupt_lead_time, &_exe_write_trigger);
+			runPrefetchedOp();
+			_exe_instr_opcode = -1;
+
+			used += _exe_instr_cycles;
+
+			// the instruction may have modified the remaining code of the block
+			if (IS_BLOCK_OUTDATED(block, page) || (block->bank != CURRENT_BANK())) break;
+		}
+
+		// idle loop detection: e.g. a "JMP *" main loop or some "LDA $02 / BEQ *"
+		// polling that waits for an interrupt handler. Once an iteration of a loop
+		// that doesn't write to memory no longer changes the CPU's state, all the
+		// following iterations will be identical (nothing else can change the
+		// memory that the loop may be reading while VIC and CIA are idle), i.e. the
+		// CPU can be fast-forwarded to the next event.
+		if (block->is_loop && (i == block->ops) && (_pc == block->pc) &&
+				(a == _a) && (x == _x) && (y == _y) && (p == _p) && (s == _s)) {
+			const uint32_t c = used - start;
+			used += ((cycles - used) / c) * c;	// skip complete iterations only
+		}
+	}
+	return blocksDone(used);
+}
+
+uint8_t cpuIsFetching() {
+	return _exe_instr_opcode < 0;
+}
+
 void cpuInit(uint8_t is_rsid) {
 	cpuClock = is_rsid ? &cpuClockRSID : &cpuClockPSID;
 
+	if (_profile) wrapClock();
+
+	initOpDescriptors();
+	flushBlocks();
+
 	cpuStatusInit();
 
 	_exe_instr_cycles = _exe_instr_cycles_remain = _exe_write_trigger = 0;
@@ -475,4 +1020,5 @@ void cpuInit(uint8_t is_rsid) {
 
 	_irq_line_ts = _irq_committed = 0;
 	_nmi_line = _nmi_line_ts = _nmi_committed = 0;
+	_int_check = 1;
 }
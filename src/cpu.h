@@ -18,13 +18,46 @@
 void		cpuInit(uint8_t is_rsid);
 void 		cpuSetProgramCounter(uint16_t pc, uint8_t a);
 
-extern void (*cpuClock)();		// cpuClock function pointer (crappy C requires different syntax here)
+extern THREAD_LOCAL void (*cpuClock)();		// cpuClock function pointer (crappy C requires different syntax here)
+void		cpuClockRSID();		// the different cpuClock implementations
+void		cpuClockPSID();
+
+// event scheduling (see sysClockEvents())
+uint32_t	cpuCyclesToEvent();	// 1 = the next cpuClock() must be run
+void		cpuSkip(uint32_t cycles);
+uint8_t		cpuIsFetching();	// next cpuClock() starts a new instruction
+uint32_t	cpuBlockCycles();	// worst case duration of the cached block that can be run next (0 = none)
+uint32_t	cpuRunBlocks(uint32_t cycles);	// runs cached blocks within the available cycles
+
+// interrupt lines (the chips report each change of their respective output)
+#define IRQ_SRC_VIC	0x1
+#define IRQ_SRC_CIA	0x2
+void		cpuSetIRQLine(uint8_t source, uint8_t on);
+void		cpuSetNMILine(uint8_t on);
 
 // PSID only crap
 uint8_t		cpuIsValidPcPSID();
 void		cpuSetProgramCounterPSID(uint16_t pc);
 void		cpuIrqFlagPSID(uint8_t on);
 
+// hot-spot profiling (off by default): while enabled, cpuClock is wrapped by
+// a function that counts where the emulated cycles are spent
+struct CpuProfile {
+	uint32_t pc_cycles[0x10000];	// cycles of the instructions that started at the address (incl. VIC stuns)
+	uint32_t pc_count[0x10000];		// number of executions
+	uint8_t pc_opcode[0x10000];		// last opcode executed at the address
+	uint32_t op_cycles[256];		// the same per opcode (the IRQ/NMI entry sequences are
+	uint32_t op_count[256];			// listed as the pseudo opcodes CPU_PROFILE_IRQ_OP/CPU_PROFILE_NMI_OP)
+	uint32_t irq_count;				// interrupt entries
+	uint32_t nmi_count;
+	uint32_t stun_cycles;			// cycles that the CPU was stunned by VIC
+};
+#define CPU_PROFILE_IRQ_OP 0x02
+#define CPU_PROFILE_NMI_OP 0x12
+
+void		cpuEnableProfile(uint8_t on);	// (re)starts with an empty profile
+const struct CpuProfile* cpuGetProfile();	// 0 if not enabled
+
 #ifdef DEBUG
 uint16_t	cpuGetPC();
 uint8_t		cpuGetSP();
@@ -33,4 +66,19 @@ uint8_t		cpuGetSP();
 
 void		cpuHackNMI(uint8_t on);
 
+
+// -------------------- performance optimization --------------------------
+
+#ifdef OPT_USE_INLINE_ACCESS
+extern THREAD_LOCAL int16_t _exe_instr_opcode;	// MUST NOT BE USED DIRECTLY
+
+#define CPU_IS_FETCHING() \
+	(_exe_instr_opcode < 0)
+
+#else
+
+#define CPU_IS_FETCHING() \
+	cpuIsFetching()
+#endif
+
 #endif
\ No newline at end of file
@@ -76,12 +76,8 @@ extern "C" {
 #define MASK_DIGI_UNUSED 0x80
 #define CENTER_SAMPLE 0x80
 
-DigiDetector::DigiDetector(SID* sid) {
-	_sid = sid;
-	_base_addr = 0;	// not available at this point
-	_digi_source = MASK_DIGI_UNUSED;
-	_is_compatible = 1;
-	_is_rsid = 1;
+void DigiDetector::init(SID* sid) {
+	_sid = sid;		// the remaining state is set up via reset()
 }
 
 bool DigiDetector::isMahoney() {
@@ -593,15 +589,15 @@ uint8_t DigiDetector::handleSwallowDigi(uint8_t voice, uint8_t reg,
 // ------------------------ legacy PSID digi stuff ------------------------------
 // (this is probably about the only code left from the original TinySID impl)
 
-static int32_t _sample_active;
-static int32_t _sample_position, _sample_start, _sample_end, _sample_repeat_start;
-static int32_t _frac_pos = 0;  /* Fractal position of sample */
-static int32_t _sample_period;
-static int32_t _sample_repeats;
-static int32_t _sample_order;
-static int32_t _sample_nibble;
+static THREAD_LOCAL int32_t _sample_active;
+static THREAD_LOCAL int32_t _sample_position, _sample_start, _sample_end, _sample_repeat_start;
+static THREAD_LOCAL int32_t _frac_pos = 0;  /* Fractal position of sample */
+static THREAD_LOCAL int32_t _sample_period;
+static THREAD_LOCAL int32_t _sample_repeats;
+static THREAD_LOCAL int32_t _sample_order;
+static THREAD_LOCAL int32_t _sample_nibble;
 
-static int32_t _internal_period, _internal_order, _internal_start, _internal_end,
+static THREAD_LOCAL int32_t _internal_period, _internal_order, _internal_start, _internal_end,
 _internal_add, _internal_repeat_times, _internal_repeat_start;
 
 static void handlePsidDigi(uint16_t addr, uint8_t value) {
@@ -668,7 +664,7 @@ static void handlePsidDigi(uint16_t addr, uint8_t value) {
 
 int32_t DigiDetector::genPsidSample(int32_t sample_in)
 {
-    static int32_t sample = 0;
+    static THREAD_LOCAL int32_t sample = 0;
 
     if (!_sample_active) return sample_in;
 
@@ -717,7 +713,7 @@ int32_t DigiDetector::genPsidSample(int32_t sample_in)
     return sample_in;
 }
 
-uint8_t _slow_down = 1;
+THREAD_LOCAL uint8_t _slow_down = 1;
 void DigiDetector::resetCount() {
 	_slow_down = !_slow_down;
 	if (_slow_down) {
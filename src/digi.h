@@ -43,7 +43,9 @@ class DigiDetector {
 protected:
 	friend class SID;
 	
-	DigiDetector(class SID* sid);
+	// the SID owning this instance (there is no constructor so that the thread
+	// local SIDs can be statically allocated, see SID::resetAll())
+	void init(class SID* sid);
 	
 	// setup
 	void reset(uint32_t clock_rate, uint8_t is_rsid, uint8_t is_compatible);
@@ -123,37 +123,14 @@ void initDelays() {
 */
 
 	
-// keep state in a separate struct to avoid exposure in the header file..
-struct EnvelopeState {
- 		// raw register content
-	uint8_t ad;
-	uint8_t sr;
-
-	uint8_t envphase;
-
-    uint16_t attack;	// for 255 steps
-    uint16_t decay;		// for 255 steps
-    uint16_t sustain;
-    uint16_t release;
-
-	uint8_t envelope_output;
-	
-	uint16_t current_LFSR;	// sim counter	(continuously counting / only reset by AD(S)R match)
-	uint8_t zero_lock;  
-	uint8_t exponential_counter;    
-};
-
 // this should rather be static - but "friend" wouldn't work then
 struct EnvelopeState* getState(Envelope* e) {	
-	return (struct EnvelopeState*)e->_state;
+	return &e->_state;
 }
 
-Envelope::Envelope(SID* sid, uint8_t voice) {
+void Envelope::init(SID* sid, uint8_t voice) {
 	_sid = sid;
 	_voice = voice;
-	_state = (void*) malloc(sizeof(struct EnvelopeState));
-		
-	syncADR();
 }
 
 void Envelope::syncADR() {
@@ -176,6 +153,8 @@ void Envelope::poke(uint8_t reg, uint8_t val) {
 	// thanks to the cycle-by-cycle emulation the below interactions are perfectly
 	// in sync with SID (and a post-mortem workarounds are no longer required)
 
+	wake(getState(this));	// all the below changes depend on the exact LFSR state
+
 	switch (reg) {
         case 0x4: {
 			struct EnvelopeState* state= getState(this);
@@ -231,6 +210,7 @@ void Envelope::poke(uint8_t reg, uint8_t val) {
 }
 
 uint8_t Envelope::getOutput() {
+	// note: the output never changes while the envelope sleeps
 	struct EnvelopeState* state = getState(this);
 	return state->envelope_output;
 }
@@ -264,9 +244,101 @@ uint8_t Envelope::handleExponentialDelay(struct EnvelopeState* state) {
 	return result;
 }
 
+// the threshold that the LFSR is currently compared against
+static uint16_t getThreshold(struct EnvelopeState* state) {
+	switch (state->envphase) {
+		case Attack:
+			return state->attack;
+		case Release:
+			return state->release;
+		default:
+			return state->decay;	// sustain keeps using the decay threshold
+	}
+}
+
+// cycles until the LFSR next matches the threshold (see ADSR-bug notes below)
+static uint32_t cyclesToThreshold(uint16_t lfsr, uint16_t threshold) {
+	return (threshold > lfsr) ? threshold - lfsr : LFSR_LIMIT - lfsr + threshold;
+}
+
+/*
+* Most of the time the envelope generator is just counting: e.g. in the sustain
+* phase, while it is zero-locked or while it is waiting for the next LFSR match
+* of a slow attack/decay/release. The cycle of the next visible change (level
+* or phase) can be calculated in closed form from the LFSR position, the
+* threshold and the exponential delay, and the envelope "sleeps" until then.
+* The LFSR/exponential counter are only caught up when needed (see wake()),
+* i.e. the ADSR-bug behavior is exactly the same as for the regular clocking.
+*/
+void Envelope::sleep(struct EnvelopeState* state) {
+	uint32_t cycles = 0xffffffff;	// cycles until the next visible change
+
+	switch (state->envphase) {
+		case Attack:
+			if (!state->zero_lock) {	// each match increases the level
+				cycles = cyclesToThreshold(state->current_LFSR, state->attack);
+			}
+			break;
+		case Decay:
+		case Release:
+			if (!state->zero_lock) {	// the match that completes the exponential delay
+				const uint16_t threshold = getThreshold(state);
+				const uint8_t delay = EXPONENTIAL_DELAYS[state->envelope_output];
+				const uint32_t matches = (state->exponential_counter + 1 >= delay) ? 1 : delay - state->exponential_counter;
+
+				cycles = cyclesToThreshold(state->current_LFSR, threshold) + (matches - 1) * threshold;
+			}
+			break;
+		case Sustain:
+			if (state->envelope_output > state->sustain) {
+				cycles = 1;				// switch back to decay
+			}
+			break;
+	}
+	// the cycle with the change itself is clocked regularily
+	state->sleep_cycles = state->sleep_len = cycles - 1;
+}
+
+// catch up with the cycles that have been skipped while sleeping
+void Envelope::wake(struct EnvelopeState* state) {
+	uint32_t elapsed = state->sleep_len - state->sleep_cycles;
+	state->sleep_cycles = state->sleep_len = 0;
+
+	if (!elapsed) return;
+
+	const uint16_t threshold = getThreshold(state);
+	const uint32_t first = cyclesToThreshold(state->current_LFSR, threshold);
+
+	if (elapsed < first) {
+		const uint32_t lfsr = state->current_LFSR + elapsed;
+		state->current_LFSR = (lfsr >= LFSR_LIMIT) ? lfsr - LFSR_LIMIT : lfsr;
+	} else {
+		// each match resets the LFSR to 0
+		elapsed -= first;
+		const uint32_t matches = 1 + elapsed / threshold;
+		state->current_LFSR = elapsed % threshold;
+
+		if ((state->envphase == Decay) || (state->envphase == Release)) {
+			// see handleExponentialDelay(): the level (and delay) stays the
+			// same while sleeping
+			const uint8_t delay = EXPONENTIAL_DELAYS[state->envelope_output];
+
+			uint32_t counter = state->exponential_counter + 1;
+			if (counter >= delay) counter = 0;
+			state->exponential_counter = (counter + matches - 1) % delay;
+		}
+	}
+}
+
 void Envelope::clockEnvelope() {
 	struct EnvelopeState* state = getState(this);
-			
+
+	if (state->sleep_cycles) {
+		state->sleep_cycles--;
+		return;
+	}
+	wake(state);
+
 	if (++state->current_LFSR >= LFSR_LIMIT) {
 		state->current_LFSR = 0;
 	}
@@ -332,6 +404,8 @@ void Envelope::clockEnvelope() {
 	if ((state->envelope_output == 0) && (previous_envelope_output > state->envelope_output)) {
 		state->zero_lock = 1;	// new "attack" phase must be started to unlock
 	}
+
+	sleep(state);
 }
 
 /*
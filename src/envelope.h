@@ -14,6 +14,29 @@ extern "C" {
 #include "base.h"
 }
 
+struct EnvelopeState {
+ 		// raw register content
+	uint8_t ad;
+	uint8_t sr;
+
+	uint8_t envphase;
+
+    uint16_t attack;	// for 255 steps
+    uint16_t decay;		// for 255 steps
+    uint16_t sustain;
+    uint16_t release;
+
+	uint8_t envelope_output;
+
+	uint16_t current_LFSR;	// sim counter	(continuously counting / only reset by AD(S)R match)
+	uint8_t zero_lock;
+	uint8_t exponential_counter;
+
+		// performance optimization (see Envelope::sleep())
+	uint32_t sleep_cycles;	// remaining cycles during which nothing visible happens
+	uint32_t sleep_len;		// cycles originally planned for the current sleep phase
+};
+
 /**
 * This class handles the envelope generation for one specific voice of the SID chip.
 *
@@ -22,7 +45,7 @@ extern "C" {
 class Envelope {
 protected:
 	friend class SID;
-	Envelope(class SID* sid, uint8_t voice);
+	void init(class SID* sid, uint8_t voice);	// see DigiDetector::init()
 		
 	/**
 	* Reinitialize a specific instance to reuse it.
@@ -53,11 +76,14 @@ private:
 	void syncADR();
 	uint8_t triggerLFSR_Threshold(uint16_t threshold, uint16_t* end);
 	uint8_t handleExponentialDelay(struct EnvelopeState* state);
+
+	void sleep(struct EnvelopeState* state);
+	void wake(struct EnvelopeState* state);
 	
 private:
 	friend struct EnvelopeState* getState(Envelope *e);
 
-	void* _state;	// don't want this header file cluttered with all the implementation details..
+	struct EnvelopeState _state;
 	class SID* _sid;
 	uint8_t _voice;
 };
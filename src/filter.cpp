@@ -24,6 +24,8 @@
 // => repeated integer oparations are usually cheaper when floating point divisions are the alternative
 
 #include "filter.h"
+#include "filter6581.h"
+#include "filter8580.h"
 
 #include <string.h>
 #include <stdio.h>
@@ -36,19 +38,59 @@ const double FILTERED_SCOPE_SCALEDOWN =  0.2;	// tuned using "424.sid"
 
 #include "sid.h"
 
-uint32_t Filter::_sample_rate;
+THREAD_LOCAL uint32_t Filter::_sample_rate;
+THREAD_LOCAL uint8_t Filter::_fixed_point = 0;
 
-Filter::Filter(SID* sid) {
+void Filter::init(SID* sid) {
 	_sid = sid;
 }
 
-Filter::~Filter() {
+void Filter::setModel(bool set_6581) {
+	_is_6581 = set_6581;
+
+	if (_is_6581) Filter6581::init();
+}
+
+void Filter::setFixedPoint(uint8_t on) {
+	_fixed_point = on;
+}
+
+uint8_t Filter::isFixedPoint() {
+	return _fixed_point;
+}
+
+void Filter::resyncCache() {
+	if (_is_6581) {
+		Filter6581::resyncCache(this);
+	} else {
+		Filter8580::resyncCache(this);
+	}
+}
+
+double Filter::doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
+	return _is_6581 ? Filter6581::doGetFilterOutput(this, sum_filter_in, band_pass, low_pass, hi_pass) :
+						Filter8580::doGetFilterOutput(this, sum_filter_in, band_pass, low_pass, hi_pass);
+}
+
+int32_t Filter::doGetFixedFilterOutput(int32_t sum_filter_in, int32_t* band_pass, int32_t* low_pass, int32_t* hi_pass) {
+	return _is_6581 ? Filter6581::doGetFixedFilterOutput(this, sum_filter_in, band_pass, low_pass, hi_pass) :
+						Filter8580::doGetFixedFilterOutput(this, sum_filter_in, band_pass, low_pass, hi_pass);
+}
+
+double Filter::filterVoice(FilterState* s, int32_t in) {
+	if (_fixed_point) {
+		int32_t out = doGetFixedFilterOutput(fltSaturate(((int64_t)in) << FLT_SIGNAL_BITS),
+												&s->_bp_fix, &s->_lp_fix, &s->_hp_fix);
+		return (out + (1 << (FLT_SIGNAL_BITS - 1))) >> FLT_SIGNAL_BITS;
+	}
+	return doGetFilterOutput(in, &s->_bp_out, &s->_lp_out, &s->_hp_out);
 }
 
 void Filter::clearFilterState() {
 	for (int i= 0; i<3; i++) {
 		struct FilterState *state = &_voice[i];
 		state->_lp_out = state->_bp_out = state->_hp_out = 0;
+		state->_lp_fix = state->_bp_fix = state->_hp_fix = 0;
 	}
 }
 
@@ -65,6 +107,7 @@ static bool getBit(uint32_t val, uint8_t idx) { return (bool) ((val >> idx) & 1)
 void Filter::clearSimOut(uint8_t voice_idx) {
 	struct FilterState *state = &_sim_voice[voice_idx];
 	state->_lp_out = state->_bp_out = state->_hp_out = 0;
+	state->_lp_fix = state->_bp_fix = state->_hp_fix = 0;
 }
 
 void Filter::poke(uint8_t reg, uint8_t val) {
@@ -124,7 +167,7 @@ int32_t Filter::getVoiceOutput(int32_t voice_idx, int32_t* in) {
 	// regular routing
 	if (_filter_ena[voice_idx] && _is_filter_on) {
 		// route to filter
-		out= doGetFilterOutput(*in, &s->_bp_out, &s->_lp_out, &s->_hp_out);
+		out= filterVoice(s, *in);
 	} else {
 		// route directly to output
 		out= *in;
@@ -152,7 +195,7 @@ int32_t Filter::getVoiceScopeOutput(int32_t voice_idx, int32_t* in) {
 	// regular routing
 	if (_filter_ena[voice_idx] && _is_filter_on) {
 		// route to filter
-		out= doGetFilterOutput(*in, &s->_bp_out, &s->_lp_out, &s->_hp_out) * FILTERED_SCOPE_SCALEDOWN;
+		out= filterVoice(s, *in) * FILTERED_SCOPE_SCALEDOWN;
 	} else {
 		// route directly to output
 		out= *in * SCOPE_SCALEDOWN;
@@ -35,18 +35,55 @@ struct FilterState {
 	double _lp_out;	// previous "low pass" output
 	double _bp_out;	// previous "band pass" output
 	double _hp_out;	// previous "hi pass" output
+
+	// same for the fixed-point impl (see Filter::setFixedPoint())
+	int32_t _lp_fix;
+	int32_t _bp_fix;
+	int32_t _hp_fix;
 };
 
+// Fixed-point filter impl: signals are int32 with FLT_SIGNAL_BITS fraction
+// bits and the multipliers (cutoff, resonance) use FLT_COEF_BITS fraction bits.
+// All the results saturate (symmetrically, i.e. any value can be negated).
+#define FLT_SIGNAL_BITS 8
+#define FLT_COEF_BITS 24
+#define FLT_MAX 0x7fffffff
+
+static inline int32_t fltSaturate(int64_t v) {
+	return v > FLT_MAX ? FLT_MAX : (v < -FLT_MAX ? -FLT_MAX : (int32_t)v);
+}
+
+// signal * coefficient (rounded)
+static inline int32_t fltMul(int32_t signal, int32_t coef) {
+	return fltSaturate((((int64_t)signal) * coef + (1 << (FLT_COEF_BITS - 1))) >> FLT_COEF_BITS);
+}
+
 /**
 * This class handles the filter of a SID chip.
 *
+* The chip model specific parts are implemented in Filter6581 and Filter8580
+* and the model used by a specific instance is selected via setModel(). (The
+* SID embeds its filter and a model switch therefore must not replace the
+* instance.)
+*
 * It is a construct exclusively used by the SID class and access is restricted accordingly.
 */
 class Filter {
+public:
+	/**
+	* Switches between the default double precision impl and the (cheaper)
+	* fixed-point impl of the filter. The setting is used by all the SIDs of
+	* the calling thread and it should be set before a song is started (the
+	* two impls do not share their state, i.e. a switch during playback
+	* causes a glitch).
+	*/
+	static void setFixedPoint(uint8_t on);
+	static uint8_t isFixedPoint();
+
 protected:
-	Filter(class SID* sid);
-	virtual ~Filter();
-		
+	void init(class SID* sid);	// see DigiDetector::init()
+
+	void setModel(bool set_6581);
 	void setSampleRate(uint32_t sample_rate);
 
 	int32_t getVoiceOutput(int32_t voice_idx, int32_t* in);
@@ -61,22 +98,27 @@ protected:
 
 
 	/**
-	* Hooks that must be defined in subclasses.
+	* Dispatch to the model specific impls.
 	*/
-	virtual void resyncCache() = 0;
-	virtual double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) = 0;
+	void resyncCache();
+	double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
+	int32_t doGetFixedFilterOutput(int32_t sum_filter_in, int32_t* band_pass, int32_t* low_pass, int32_t* hi_pass);
 
 private:
 	friend class SID;
 	friend class DigiDetector;
+	friend class Filter6581;
+	friend class Filter8580;
 	void clearSimOut(uint8_t voice_idx);
+	double filterVoice(FilterState* s, int32_t in);
 
 	class SID* _sid;
 
 	void clearFilterState();
 	
 protected:
-	static uint32_t _sample_rate;		// target playback sample rate
+	static THREAD_LOCAL uint32_t _sample_rate;		// target playback sample rate
+	static THREAD_LOCAL uint8_t _fixed_point;		// use fixed-point impl
 
 	// register input
 	uint8_t _reg_cutoff_lo;		// filter cutoff low (3 bits)
@@ -90,6 +132,16 @@ protected:
 		
 	// term used in biquad (1/Q)
 	double _resonance;
+
+	// model specific state
+	bool _is_6581;
+	double _reg_cutoff;			// 6581: combined content of "11-bit filter cutoff" register
+	double _cutoff_ratio_8580;	// 8580
+	double _cutoff;				// 8580
+
+	// fixed-point versions of the above
+	int32_t _resonance_fix;
+	int32_t _cutoff_fix;		// 8580
 		
 private:
 		// control flags from registers	
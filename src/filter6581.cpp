@@ -66,6 +66,16 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include <memory>
+#include <atomic>
+
+#ifndef EMSCRIPTEN
+#include <mutex>
+
+// the filter configs are shared by all the threads (see context.h)
+static std::mutex _init_mutex;
+#endif
+
 
 #define MAX_AMP 80000	// just a wild guess
 #define DIST_IDX_SCALER (((double)DIST_LEVELS)/(CUTOFF_SIZE*2))
@@ -80,70 +90,146 @@ double calcDistRescale(double distort_offset, double distort_scale) {
 	return w < (CUTOFF_SIZE*2) ? DIST_IDX_SCALER : DIST_IDX_SCALER *(w/(CUTOFF_SIZE*2));
 }
 
+/**
+* Immutable snapshot of one filter config (see setFilterConfig6581) together with
+* the distortion table derived from it.
+*
+* A config change creates a new snapshot, i.e. the threads that are still using
+* the old one are not disturbed. The rows of the table are only calculated when
+* they are first used and a calculated row never changes.
+*/
+struct Filter6581Config {
+		// base curve
+	double base;				// curve's min
+	double max;					// curve's max
+	double steepness;			// steepness of the S-curve's center section (lower is steeper)
+	double x_offset;			// amount of "right moving" the S-curve (0 puts the rising inflection point
+								// at 0)
+		// "voltage based" distortion
+	double distort;				// difference between successive distortion levels
+	double distort_offset;		// filter-output/cutoff register "voltage" offset to create positive range
+	double distort_scale;		// filter-output/cutoff register "voltage" scaling used to map distortion
+	double distort_threshold;	// filter-output/cutoff register "voltage" threshold above which distortion kicks in
+		// kinking effect
+	double kink;
+
+	double distort_1_div_scale;	// optimization based on distort_scale
+	double distort_rescale;		// optimization based on distort_scale
+
+	// fixed-point impl: the cutoffMultiplier() index calculation as a
+	// linear function with 32 fraction bits
+	int64_t dist_idx_scale;		// per unit of the (fixed-point) filter_out
+	int64_t dist_idx_cutoff;	// per unit of the cutoff register
+	int64_t dist_idx_offset;
+
+	uint32_t gen;				// see _config_gen
+
+	// precalculated filter cutoffs for different levels of distortion (float is
+	// precise enough here and it halves the size of this 1024x256 table)
+	float* tbls_by_cutoff;				// [CUTOFF_SIZE][DIST_LEVELS]
+	std::atomic<uint8_t> tbl_ready[CUTOFF_SIZE];
+
+	Filter6581Config() {
+		// calloc: the memory of the rows that are never used is not even touched
+		tbls_by_cutoff = (float*)calloc(CUTOFF_SIZE * DIST_LEVELS, sizeof(float));
+		for (int i= 0; i<CUTOFF_SIZE; i++) tbl_ready[i] = 0;
+	}
+	~Filter6581Config() {
+		free(tbls_by_cutoff);
+	}
+};
+
 // XXX fixme; defaults tuned using 48kHz samplerate.. adjust to the actually used sample rate!
 
-// The below settings were hand-tuned using a MOS 6581 R4AR.
+// The below settings were hand-tuned using a MOS 6581 R4AR (same order as in setFilterConfig6581).
 // params are global and equally affect all SIDs configured to emulate a 6581 model
+static const double DEFAULT_CONFIG_6581[9] = {
+	0.036,		// base
+	0.892,		// max
+	144.856,	// steepness
+	1473.75,	// x_offset
+	9.76,		// distort
+	87200,		// distort_offset
+	99.7875,	// distort_scale
+	1134,		// distort_threshold
+	320,		// kink
+};
+
+// the current config (use std::atomic_load/store) and its generation
+static std::shared_ptr<Filter6581Config> _current_config;
+static std::atomic<uint32_t> _config_gen(0);
+
+// keeps the config used by the calling thread alive
+static THREAD_LOCAL_OBJ std::shared_ptr<Filter6581Config> _thread_config;
+
+THREAD_LOCAL const Filter6581Config* Filter6581::_cfg = 0;
 
-	// base curve
-double Filter6581::_base = 0.036;				// curve's min
-double Filter6581::_max = 0.892;				// curve's max
-
-double Filter6581::_steepness = 144.856;		// steepness of the S-curve's center section (lower is steeper)
-double Filter6581::_x_offset =  1473.75; 		// amount of "right moving" the S-curve (0 puts the rising
-												// inflection point at 0)
-	// kinking effect
-double Filter6581::_kink = 320;
-
-	// "voltage based" distortion
-double Filter6581::_distort = 9.76;				// "step size" between successive distortion levels
-double Filter6581::_distort_offset = 87200;		// filter-output/cutoff register "voltage" scaling
-double Filter6581::_distort_scale =	99.7875;	// filter-output/cutoff register "voltage" scaling
-double Filter6581::_distort_threshold = 1134;	// filter-output/cutoff register "voltage" threshold above which
-												// distortion kicks in
-															
-double Filter6581::_distort_1_div_scale = 1.0 / Filter6581::_distort_scale;
-double Filter6581::_distort_rescale = calcDistRescale(Filter6581::_distort_offset, Filter6581::_distort_scale);
-
-												
 // copy of above params used to interface with JavaScript side
 double Filter6581::_shadow_config_6581[9];
 
-
-bool Filter6581::_distortion_cache_ready = false;
-
-// "kink"-distorted "cutoff register"
-//double Filter6581::_kinked[CUTOFF_SIZE];
-
-// precalculated filter cutoffs for different levels of distortion
-double Filter6581::_distortion_tbls_by_cutoff[CUTOFF_SIZE][DIST_LEVELS];
-
-// currently selected row from the above table: precalculated
+// currently selected row from the config's table: precalculated
 // distortion levels for the currently selected filter cutoff
-double* Filter6581::_distortion_tbl = 0;
+THREAD_LOCAL float* Filter6581::_distortion_tbl = 0;
+THREAD_LOCAL int Filter6581::_distortion_tbl_level = 0;
+
+THREAD_LOCAL int32_t Filter6581::_distortion_tbl_fix[DIST_LEVELS];
+THREAD_LOCAL float* Filter6581::_distortion_tbl_fix_src = 0;
 
 // copy of cutoff information of a specific distortion level
 // used to interface with JavaScript side
 double Filter6581::_tmp_cutoff_tbl[CUTOFF_SIZE];
 
-Filter6581::Filter6581(SID* sid) : Filter(sid) {
-	Filter6581::init();
+void Filter6581::init() {
+	{
+#ifndef EMSCRIPTEN
+		std::lock_guard<std::mutex> lock(_init_mutex);
+#endif
+		if (!std::atomic_load(&_current_config)) {
+			const double* c = DEFAULT_CONFIG_6581;
+			configure(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8]);
+		}
+	}
+	syncConfig();
 }
 
-Filter6581::~Filter6581() {
+void Filter6581::syncConfig() {
+	_thread_config = std::atomic_load(&_current_config);
+	_cfg = _thread_config.get();
+
+	_distortion_tbl = getDistortionTbl(_cfg, _distortion_tbl_level);
+	_distortion_tbl_fix_src = 0;	// the memory of a released config may be reused
 }
 
-void Filter6581::init() {
-	if (!_distortion_cache_ready)
-		Filter6581::setFilterConfig6581(_base, _max, _steepness, _x_offset, _distort, _distort_offset, _distort_scale, _distort_threshold, _kink);
+float* Filter6581::getDistortionTbl(const Filter6581Config* cfg, int cutoff_level) {
+	float* tbl = cfg->tbls_by_cutoff + cutoff_level * DIST_LEVELS;
+
+	if (!cfg->tbl_ready[cutoff_level].load(std::memory_order_acquire)) {
+#ifndef EMSCRIPTEN
+		std::lock_guard<std::mutex> lock(_init_mutex);
+#endif
+		if (!cfg->tbl_ready[cutoff_level].load(std::memory_order_relaxed)) {	// some other thread may have been faster
+			calcDistortionTbl(cfg, cutoff_level, tbl);
+
+			// const_cast: the "ready" flags are the only part of the snapshot that is
+			// ever updated (under the above lock)
+			const_cast<Filter6581Config*>(cfg)->tbl_ready[cutoff_level].store(1, std::memory_order_release);
+		}
+	}
+	return tbl;
 }
 
-void Filter6581::resyncCache() {
+void Filter6581::resyncCache(Filter* f) {
 #ifdef USE_FILTER
-	int reg_cutoff = _reg_cutoff_lo + _reg_cutoff_hi * 8;
-	_reg_cutoff = (double)reg_cutoff;
+	int reg_cutoff = f->_reg_cutoff_lo + f->_reg_cutoff_hi * 8;
+	f->_reg_cutoff = (double)reg_cutoff;
+
+	_distortion_tbl_level = reg_cutoff >> 1;
 
-	_distortion_tbl = _distortion_tbls_by_cutoff[reg_cutoff >> 1];
+	if (_cfg->gen != _config_gen) {
+		syncConfig();	// use the config that has been set since (also updates _distortion_tbl)
+	} else {
+		_distortion_tbl = getDistortionTbl(_cfg, _distortion_tbl_level);
+	}
 
 	// see http://www.fooplot.com/#W3sidHlwZSI6MCwiZXEiOiI4LjAveCIsImNvbG9yIjoiIzAwMDAwMCJ9LHsidHlwZSI6MCwiZXEiOiIxLygwLjcwNyt4LzE1KSIsImNvbG9yIjoiI0VCMEMwQyJ9LHsidHlwZSI6MCwiZXEiOiIxLjQxIiwiY29sb3IiOiIjMDAwMDAwIn0seyJ0eXBlIjowLCJlcSI6IjAuOS8oMStleHAoLSgoLXgqMTYuNykvNDApLTMuNCkpKzAuNTQiLCJjb2xvciI6IiMxODA2N0QifSx7InR5cGUiOjEwMDAsIndpbmRvdyI6WyIwIiwiMTUiLCIwIiwiMiJdfV0-
 
@@ -160,84 +246,115 @@ void Filter6581::resyncCache() {
 	// whereas some older resid here used a continuously falling curve that covered about the
 	// same result range (see red curve):
 
-	_resonance = 1.0/(0.707 + (_reg_res_flt >> 4)/0x0f);
+	f->_resonance = 1.0/(0.707 + (f->_reg_res_flt >> 4)/0x0f);
+
+	f->_resonance_fix = lround(f->_resonance * (1 << FLT_COEF_BITS));
 #endif
 }
 
-double Filter6581::cutoffMultiplier(double filter_out) {
+double Filter6581::cutoffMultiplier(Filter* f, double filter_out) {
+	const Filter6581Config* cfg = _cfg;
 
-	filter_out+= _distort_offset;		// sim "all" positive voltage levels, e.g. 0..160000 range (plus overflows at both ends)
-	filter_out*= _distort_1_div_scale;	//  scale to "same" 0..2047 range as cutoff register	
+	filter_out+= cfg->distort_offset;		// sim "all" positive voltage levels, e.g. 0..160000 range (plus overflows at both ends)
+	filter_out*= cfg->distort_1_div_scale;	//  scale to "same" 0..2047 range as cutoff register	
 
 	// "The FC and source mix together.." - todo: the used proportions might need some fine-tuning
 //	filter_out=((filter_out+_kinked[(int)_reg_cutoff])*0.5) - _distort_threshold;	// testcase where this makes any difference?
-	filter_out=((filter_out+_reg_cutoff)*0.5) - _distort_threshold;		// XXX averaging could be avoided by compensating in the other params
+	filter_out=((filter_out+f->_reg_cutoff)*0.5) - cfg->distort_threshold;		// XXX averaging could be avoided by compensating in the other params
 	
 	// XXX FIXME: the offset used on the input that is fed to filter causes a strong "flipping" effect 
 	// that on those filters that do flip.. this may well mess up the matching used here..
 	
 	int i= 0;	
 	if (filter_out > 0) {		
-		int index = (int) (filter_out * _distort_rescale);
+		int index = (int) (filter_out * cfg->distort_rescale);
 		i = index < DIST_LEVELS ? index : DIST_LEVELS-1;
 	}
 	return _distortion_tbl[i];
 }
 
 double* Filter6581::getFilterConfig6581() {
-	_shadow_config_6581[0] = _base;
-	_shadow_config_6581[1] = _max;
-	_shadow_config_6581[2] = _steepness;
-	_shadow_config_6581[3] = _x_offset;
-	_shadow_config_6581[4] = _distort;
-	_shadow_config_6581[5] = _distort_offset;
-	_shadow_config_6581[6] = _distort_scale;
-	_shadow_config_6581[7] = _distort_threshold;
-	_shadow_config_6581[8] = _kink;
+	init();	// allow access before emulator has been properly initialized
+
+	std::shared_ptr<Filter6581Config> cfg = std::atomic_load(&_current_config);
+	_shadow_config_6581[0] = cfg->base;
+	_shadow_config_6581[1] = cfg->max;
+	_shadow_config_6581[2] = cfg->steepness;
+	_shadow_config_6581[3] = cfg->x_offset;
+	_shadow_config_6581[4] = cfg->distort;
+	_shadow_config_6581[5] = cfg->distort_offset;
+	_shadow_config_6581[6] = cfg->distort_scale;
+	_shadow_config_6581[7] = cfg->distort_threshold;
+	_shadow_config_6581[8] = cfg->kink;
 
 	return _shadow_config_6581;
 }
 
 int Filter6581::setFilterConfig6581(double base, double max, double steepness, double x_offset, double distort,
 								double distort_offset, double distort_scale, double distort_threshold, double kink) {
-	_base= base;
-	_max= max;
-	_steepness= steepness;
-	_x_offset= x_offset;
-	_distort= distort;
-	_distort_offset= distort_offset;
-	_distort_scale= distort_scale;	
-	_distort_threshold= distort_threshold;
-	_kink= kink;
-	
-	_distort_1_div_scale= 1.0 / _distort_scale;
-	_distort_rescale = calcDistRescale(distort_offset, distort_scale);
+	{
+#ifndef EMSCRIPTEN
+		std::lock_guard<std::mutex> lock(_init_mutex);
+#endif
+		configure(base, max, steepness, x_offset, distort, distort_offset, distort_scale, distort_threshold, kink);
+	}
 
+	// the calling thread uses the new config right away while other threads switch
+	// to it with their next resyncCache(), i.e. their next cutoff/resonance update
+	syncConfig();
 
-	for (int cutoff_level = 0; cutoff_level < CUTOFF_SIZE; cutoff_level++) {
+	// todo/room for improvement: reset filter output of all SIDs when settings are
+	// changed... to allow recovery after bad settings..
 
-		// add "kink" distortions
-		double k= 0;
-		for (int i= 1; i<=5; i++) {	// higher sub-divisions probably make no sense (see graph)
-			int m= CUTOFF_SIZE/pow(2, i);
-			k+= ((double)(cutoff_level%m))/m*(0.05/i);
-		}
-//		_kinked[cutoff_level] = k;
+	return 0;
+}
 
-		for (int slice = 0; slice < DIST_LEVELS; slice++) {
-			double co= max * (max-base) /
-							(1.0 + exp(-((((cutoff_level<<1) - x_offset + (_kink*k)) + distort*slice)/steepness)))
-							+ base;
+void Filter6581::configure(double base, double max, double steepness, double x_offset, double distort,
+								double distort_offset, double distort_scale, double distort_threshold, double kink) {
+	std::shared_ptr<Filter6581Config> cfg = std::make_shared<Filter6581Config>();
+
+	cfg->base= base;
+	cfg->max= max;
+	cfg->steepness= steepness;
+	cfg->x_offset= x_offset;
+	cfg->distort= distort;
+	cfg->distort_offset= distort_offset;
+	cfg->distort_scale= distort_scale;	
+	cfg->distort_threshold= distort_threshold;
+	cfg->kink= kink;
+	
+	cfg->distort_1_div_scale= 1.0 / distort_scale;
+	cfg->distort_rescale = calcDistRescale(distort_offset, distort_scale);
 
-			_distortion_tbls_by_cutoff[cutoff_level][slice] = co;
-		}
+	// fixed-point impl (see cutoffMultiplier)
+	const double q32 = 4294967296.0;
+	cfg->dist_idx_scale = llround(0.5 * cfg->distort_1_div_scale * cfg->distort_rescale * (q32 / (1 << FLT_SIGNAL_BITS)));
+	cfg->dist_idx_cutoff = llround(0.5 * cfg->distort_rescale * q32);
+	cfg->dist_idx_offset = llround((0.5 * distort_offset * cfg->distort_1_div_scale - distort_threshold) * cfg->distort_rescale * q32);
+
+	cfg->gen = _config_gen + 1;
+
+	// publish the completed snapshot
+	std::atomic_store(&_current_config, cfg);
+	_config_gen = cfg->gen;
+}
+
+void Filter6581::calcDistortionTbl(const Filter6581Config* cfg, int cutoff_level, float* tbl) {
+	// add "kink" distortions
+	double k= 0;
+	for (int i= 1; i<=5; i++) {	// higher sub-divisions probably make no sense (see graph)
+		int m= CUTOFF_SIZE/pow(2, i);
+		k+= ((double)(cutoff_level%m))/m*(0.05/i);
 	}
-	_distortion_cache_ready= true;
+//	_kinked[cutoff_level] = k;
 
-	// todo/room for improvement: reset filter output of all SIDs when settings are
-	// changed... to allow recovery after bad settings..
+	for (int slice = 0; slice < DIST_LEVELS; slice++) {
+		double co= cfg->max * (cfg->max-cfg->base) /
+						(1.0 + exp(-((((cutoff_level<<1) - cfg->x_offset + (cfg->kink*k)) + cfg->distort*slice)/cfg->steepness)))
+						+ cfg->base;
 
-	return 0;
+		tbl[slice] = co;
+	}
 }
 
 double* Filter6581::getCutoff6581(int distort_level) {
@@ -245,7 +362,7 @@ double* Filter6581::getCutoff6581(int distort_level) {
 
 	if ((distort_level >= 0) && (distort_level < DIST_LEVELS)) {
 		for (int cutoff_level = 0; cutoff_level < CUTOFF_SIZE; cutoff_level++) {
-			_tmp_cutoff_tbl[cutoff_level]= _distortion_tbls_by_cutoff[cutoff_level][distort_level];
+			_tmp_cutoff_tbl[cutoff_level]= getDistortionTbl(_cfg, cutoff_level)[distort_level];
 		}
 	}
 	return _tmp_cutoff_tbl;
@@ -253,18 +370,56 @@ double* Filter6581::getCutoff6581(int distort_level) {
 
 #define DAMPEN 0.7	// needed to avoid wild oscillations in wf_02_BP_6581.sid test song
 
-double Filter6581::doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
+double Filter6581::doGetFilterOutput(Filter* f, double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
 
-	(*hi_pass) = (sum_filter_in + (*band_pass) * _resonance + (*low_pass)) * DAMPEN;
-	(*band_pass) = (*band_pass) - (*hi_pass) * cutoffMultiplier(-(*hi_pass));
-	(*low_pass) = (*low_pass) + (*band_pass) * cutoffMultiplier(-(*band_pass));
+	(*hi_pass) = (sum_filter_in + (*band_pass) * f->_resonance + (*low_pass)) * DAMPEN;
+	(*band_pass) = (*band_pass) - (*hi_pass) * cutoffMultiplier(f, -(*hi_pass));
+	(*low_pass) = (*low_pass) + (*band_pass) * cutoffMultiplier(f, -(*band_pass));
 
 	double filter_out = 0;
 
 	// verified with my different 6581 SIDs
-	if (_hipass_ena)	{ filter_out -= (*hi_pass); }
-	if (_bandpass_ena)	{ filter_out -= (*band_pass); }
-	if (_lowpass_ena)	{ filter_out += (*low_pass); }		
+	if (f->_hipass_ena)		{ filter_out -= (*hi_pass); }
+	if (f->_bandpass_ena)	{ filter_out -= (*band_pass); }
+	if (f->_lowpass_ena)	{ filter_out += (*low_pass); }		
 			
 	return filter_out;
 }
+
+int32_t Filter6581::cutoffMultiplierFixed(Filter* f, int32_t filter_out) {
+	// same as cutoffMultiplier()
+	const Filter6581Config* cfg = _cfg;
+	int64_t index = ((int64_t)filter_out) * cfg->dist_idx_scale +
+					(f->_reg_cutoff_lo + f->_reg_cutoff_hi * 8) * cfg->dist_idx_cutoff + cfg->dist_idx_offset;
+
+	int i= 0;
+	if (index > 0) {
+		index >>= 32;
+		i = index < DIST_LEVELS ? index : DIST_LEVELS-1;
+	}
+	return _distortion_tbl_fix[i];
+}
+
+#define DAMPEN_FIX ((int32_t)(DAMPEN * (1 << FLT_COEF_BITS) + 0.5))
+
+int32_t Filter6581::doGetFixedFilterOutput(Filter* f, int32_t sum_filter_in, int32_t* band_pass, int32_t* low_pass, int32_t* hi_pass) {
+	if (_distortion_tbl_fix_src != _distortion_tbl) {
+		for (int i= 0; i<DIST_LEVELS; i++) {
+			_distortion_tbl_fix[i] = lround(_distortion_tbl[i] * (1 << FLT_COEF_BITS));
+		}
+		_distortion_tbl_fix_src = _distortion_tbl;
+	}
+
+	// same as above
+	(*hi_pass) = fltMul(fltSaturate((int64_t)sum_filter_in + fltMul(*band_pass, f->_resonance_fix) + (*low_pass)), DAMPEN_FIX);
+	(*band_pass) = fltSaturate((int64_t)(*band_pass) - fltMul(*hi_pass, cutoffMultiplierFixed(f, -(*hi_pass))));
+	(*low_pass) = fltSaturate((int64_t)(*low_pass) + fltMul(*band_pass, cutoffMultiplierFixed(f, -(*band_pass))));
+
+	int64_t filter_out = 0;
+
+	if (f->_hipass_ena)		{ filter_out -= (*hi_pass); }
+	if (f->_bandpass_ena)	{ filter_out -= (*band_pass); }
+	if (f->_lowpass_ena)	{ filter_out += (*low_pass); }
+
+	return fltSaturate(filter_out);
+}
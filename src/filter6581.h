@@ -16,13 +16,15 @@
 #define CUTOFF_SIZE 1024
 #define DIST_LEVELS 256	// number of different distortion levels
 
+struct Filter6581Config;
+
 /**
-* This class handles the filter of a 6581 revision chip.
+* This class handles the 6581 revision specific parts of the filter (see Filter).
 *
 * Except for the accessors to the global configuration, it is a construct exclusively 
-* used by the SID class and access is restricted accordingly.
+* used by the Filter class and access is restricted accordingly.
 */
-class Filter6581 : public Filter {
+class Filter6581 {
 public:
 	// "emscripten friendly" array containing the used filter params (same order as in below setter)
 	static double* getFilterConfig6581();
@@ -37,57 +39,50 @@ public:
 	static double* getCutoff6581(int distort_level);
 
 protected:
-	Filter6581(class SID* sid);
-	virtual ~Filter6581();
+	friend class Filter;
 
 	static void init();
 
-	virtual void resyncCache();
+	static void resyncCache(Filter* f);
+
+	static double doGetFilterOutput(Filter* f, double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
 
-	virtual double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
+	static double cutoffMultiplier(Filter* f, double filter_out);
 
-	double cutoffMultiplier(double filter_out);
-	
-	friend class SID;		
+	static int32_t doGetFixedFilterOutput(Filter* f, int32_t sum_filter_in, int32_t* band_pass, int32_t* low_pass, int32_t* hi_pass);
+	static int32_t cutoffMultiplierFixed(Filter* f, int32_t filter_out);
 private:
-		// base curve
-	static double _base;				// curve's min
-	static double _max;					// curve's max
-	static double _steepness;			// steepness of the S-curve's center section (lower is steeper)
-	static double _x_offset;			// amount of "right moving" the S-curve (0 puts the rising inflection point
-										// at 0)
-		// "voltage based" distortion
-	static double _distort;				// difference between successive distortion levels
-	static double _distort_offset;		// filter-output/cutoff register "voltage" offset to create positive range
-	static double _distort_scale;		// filter-output/cutoff register "voltage" scaling used to map distortion
-	static double _distort_threshold;	// filter-output/cutoff register "voltage" threshold above which distortion kicks in
-
-	static double _distort_1_div_scale;	// optimization based on _distort_scale
-	static double _distort_rescale;		// optimization based on _distort_scale
-		// kinking effect
-	static double _kink;
-
-	// copy of above params used to interface with JavaScript side
-	static double _shadow_config_6581[9];
+	static void configure(double base, double max, double steepness, double x_offset, double distort,
+								double distort_offset, double distort_scale, double distort_threshold, double kink);
+
+	// switches the calling thread to the current config
+	static void syncConfig();
 
-	static bool _distortion_cache_ready;
+	// the rows of a config's table are only calculated when they are first used
+	static float* getDistortionTbl(const Filter6581Config* cfg, int cutoff_level);
+	static void calcDistortionTbl(const Filter6581Config* cfg, int cutoff_level, float* tbl);
+
+	// config used by the calling thread (see Filter6581Config)
+	static THREAD_LOCAL const Filter6581Config* _cfg;
+
+	// copy of the config params used to interface with JavaScript side
+	static double _shadow_config_6581[9];
 
 	// "kink"-distorted "cutoff register"
 	//static double _kinked[CUTOFF_SIZE];
 
-	// precalculated filter cutoffs for different levels of distortion
-	static double _distortion_tbls_by_cutoff[CUTOFF_SIZE][DIST_LEVELS];
-
-	// currently selected row from the above table: precalculated
+	// currently selected row from the config's table: precalculated
 	// distortion levels for the currently selected filter cutoff
-	static double* _distortion_tbl;
+	static THREAD_LOCAL float* _distortion_tbl;
+	static THREAD_LOCAL int _distortion_tbl_level;
+
+	// fixed-point copy of _distortion_tbl (updated on demand, see _distortion_tbl_fix_src)
+	static THREAD_LOCAL int32_t _distortion_tbl_fix[DIST_LEVELS];
+	static THREAD_LOCAL float* _distortion_tbl_fix_src;
 
 	// copy of cutoff information of a specific distortion level 
 	// used to interface with JavaScript side
 	static double _tmp_cutoff_tbl[CUTOFF_SIZE];
-	
-	// combined content of "11-bit filter cutoff" register
-	double _reg_cutoff;	
 };
 
 #endif
@@ -18,34 +18,31 @@
 #include <stdlib.h>
 
 
-Filter8580::Filter8580(SID* sid) : Filter(sid) {
-}
-
-Filter8580::~Filter8580() {
-}
-
-void Filter8580::resyncCache() {
+void Filter8580::resyncCache(Filter* f) {
 	// since this only depends on the sid regs, it is sufficient to update this after reg updates
 #ifdef USE_FILTER
-   _cutoff_ratio_8580 = ((double) -2.0) * 3.1415926535897932385 * (12500.0 / 2048) / _sample_rate;
+   f->_cutoff_ratio_8580 = ((double) -2.0) * 3.1415926535897932385 * (12500.0 / 2048) / Filter::_sample_rate;
 
 	// NOTE: +1 is meant to model that even a 0 cutoff will still let through some signal..
-	_cutoff = ((double)_reg_cutoff_lo) +  _reg_cutoff_hi * 8 + 1;
+	f->_cutoff = ((double)f->_reg_cutoff_lo) +  f->_reg_cutoff_hi * 8 + 1;
 
 	// slightly arched curve that rises from 0 to ca 0.8 (rises progressively slower)
 	// http://www.fooplot.com/#W3sidHlwZSI6MCwiZXEiOiIxLjAtZXhwKHgqLTcuOTg5NDgzMjcwMjM3NzE0NzM4MTE1MDM5NTI4NjAzOWUtNCkiLCJjb2xvciI6IiMwMDAwMDAifSx7InR5cGUiOjEwMDAsIndpbmRvdyI6WyIxIiwiMjA0OCIsIjAiLCIxLjEiXX1d
-	_cutoff = 1.0 - exp(_cutoff * _cutoff_ratio_8580);
+	f->_cutoff = 1.0 - exp(f->_cutoff * f->_cutoff_ratio_8580);
 
 	// seems to be similar to what old resid is using but resulting in lower end-point
-	_resonance = pow(2.0, ((4.0 - (_reg_res_flt >> 4)) / 8));	// i.e. 1.41 to 0.39
+	f->_resonance = pow(2.0, ((4.0 - (f->_reg_res_flt >> 4)) / 8));	// i.e. 1.41 to 0.39
+
+	f->_cutoff_fix = lround(f->_cutoff * (1 << FLT_COEF_BITS));
+	f->_resonance_fix = lround(f->_resonance * (1 << FLT_COEF_BITS));
 #endif
 }
 
-double Filter8580::doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
+double Filter8580::doGetFilterOutput(Filter* f, double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
 
-	(*hi_pass) = sum_filter_in + (*band_pass) * _resonance + (*low_pass);
-	(*band_pass) = (*band_pass) - (*hi_pass) * _cutoff;
-	(*low_pass) = (*low_pass) + (*band_pass) * _cutoff;
+	(*hi_pass) = sum_filter_in + (*band_pass) * f->_resonance + (*low_pass);
+	(*band_pass) = (*band_pass) - (*hi_pass) * f->_cutoff;
+	(*low_pass) = (*low_pass) + (*band_pass) * f->_cutoff;
 
 	double filter_out = 0;
 
@@ -53,9 +50,24 @@ double Filter8580::doGetFilterOutput(double sum_filter_in, double* band_pass, do
 	// where two voices playing the same notes cancelled each other out..)
 	
 	// verified with my 8580R5
-	if (_hipass_ena)	{ filter_out -= (*hi_pass); }	
-	if (_bandpass_ena)	{ filter_out -= (*band_pass); }
-	if (_lowpass_ena)	{ filter_out += (*low_pass); }
+	if (f->_hipass_ena)		{ filter_out -= (*hi_pass); }
+	if (f->_bandpass_ena)	{ filter_out -= (*band_pass); }
+	if (f->_lowpass_ena)	{ filter_out += (*low_pass); }
 	
 	return filter_out;
 }
+
+int32_t Filter8580::doGetFixedFilterOutput(Filter* f, int32_t sum_filter_in, int32_t* band_pass, int32_t* low_pass, int32_t* hi_pass) {
+	// same as above
+	(*hi_pass) = fltSaturate((int64_t)sum_filter_in + fltMul(*band_pass, f->_resonance_fix) + (*low_pass));
+	(*band_pass) = fltSaturate((int64_t)(*band_pass) - fltMul(*hi_pass, f->_cutoff_fix));
+	(*low_pass) = fltSaturate((int64_t)(*low_pass) + fltMul(*band_pass, f->_cutoff_fix));
+
+	int64_t filter_out = 0;
+
+	if (f->_hipass_ena)		{ filter_out -= (*hi_pass); }
+	if (f->_bandpass_ena)	{ filter_out -= (*band_pass); }
+	if (f->_lowpass_ena)	{ filter_out += (*low_pass); }
+
+	return fltSaturate(filter_out);
+}
@@ -13,23 +13,18 @@
 #include "filter.h"
 
 /**
-* This class handles the filter of a 8580 revision chip.
+* This class handles the 8580 revision specific parts of the filter (see Filter).
 *
-* It is a construct exclusively used by the SID class and access is restricted accordingly.
+* It is a construct exclusively used by the Filter class and access is restricted accordingly.
 */
-class Filter8580 : public Filter{
+class Filter8580 {
 protected:
-	Filter8580(class SID* sid);
-	virtual ~Filter8580();
+	friend class Filter;
 
-	virtual void resyncCache();
-	
-	virtual double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
+	static void resyncCache(Filter* f);
 
-	friend class SID;
-private:	
-	double _cutoff_ratio_8580;
-	double _cutoff;
+	static double doGetFilterOutput(Filter* f, double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
+	static int32_t doGetFixedFilterOutput(Filter* f, int32_t sum_filter_in, int32_t* band_pass, int32_t* low_pass, int32_t* hi_pass);
 };
 
 
@@ -19,7 +19,7 @@
 #include "vic.h"
 #include "cpu.h"
 
-static uint8_t (*_defaultStunFunc)(uint8_t x, uint16_t y, uint8_t cpr);
+static THREAD_LOCAL uint8_t (*_defaultStunFunc)(uint8_t x, uint16_t y, uint8_t cpr);
 
 /*
 * Immigrant_Song.sid: hardcore badline timing
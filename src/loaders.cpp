@@ -44,7 +44,7 @@ extern "C" {
 */
 class TestFileLoader : public FileLoader {
 public:
-	TestFileLoader();
+	TestFileLoader() = default;
 
 	virtual uint32_t load(uint8_t* in_buffer, uint32_t in_buf_size, char* filename,
 							void* basic_ROM, void* char_ROM, void* kernal_ROM);
@@ -56,7 +56,7 @@ public:
 */
 class MusFileLoader : public FileLoader {
 public:
-	MusFileLoader();
+	MusFileLoader() = default;
 
 	virtual uint32_t load(uint8_t* in_buffer, uint32_t in_buf_size, char* filename,
 							void* basic_ROM, void* char_ROM, void* kernal_ROM);
@@ -71,7 +71,7 @@ private:
 */
 class SidFileLoader : public FileLoader {
 public:
-	SidFileLoader();
+	SidFileLoader() = default;
 
 	virtual uint32_t load(uint8_t* in_buffer, uint32_t in_buf_size, char* filename,
 							void* basic_ROM, void* char_ROM, void* kernal_ROM);
@@ -80,19 +80,19 @@ public:
 
 // ----  meta information originating from music file  ----------------------------------
 
-static uint8_t 	_sid_file_version;
+static THREAD_LOCAL uint8_t 	_sid_file_version;
 
-static uint8_t	_is_rsid;
+static THREAD_LOCAL uint8_t	_is_rsid;
 
-static uint8_t 	_ntsc_mode= 0;
+static THREAD_LOCAL uint8_t 	_ntsc_mode= 0;
 
-static uint8_t 	_compatibility;	// i.e. song should play on a real C64
-static uint8_t 	_basic_prog;
-static uint16_t _free_space;
+static THREAD_LOCAL uint8_t 	_compatibility;	// i.e. song should play on a real C64
+static THREAD_LOCAL uint8_t 	_basic_prog;
+static THREAD_LOCAL uint16_t _free_space;
 
-static uint16_t	_load_addr, _init_addr, _play_addr, _load_end_addr;
-static uint8_t 	_selected_track, _max_track;
-static uint32_t	_play_speed;
+static THREAD_LOCAL uint16_t	_load_addr, _init_addr, _play_addr, _load_end_addr;
+static THREAD_LOCAL uint8_t 	_selected_track, _max_track;
+static THREAD_LOCAL uint32_t	_play_speed;
 
 // song specific infos
 	// 0: load_addr;
@@ -102,17 +102,17 @@ static uint32_t	_play_speed;
 	// 4: song_same;
 	// 5: song_author;
 	// 6: song_copyright;
-static void* _load_result[7];
+static THREAD_LOCAL void* _load_result[7];
 
 #define MAX_INFO_LEN 32
 #define MAX_INFO_LINES 5
 
-static 	char 	_song_name[MAX_INFO_LEN + 1],
+static THREAD_LOCAL	char 	_song_name[MAX_INFO_LEN + 1],
 				_song_author[MAX_INFO_LEN + 1],
 				_song_copyright[MAX_INFO_LEN + 1],
 				_song_info_trash[MAX_INFO_LEN + 1];
 
-static char* _info_texts[MAX_INFO_LINES];
+static THREAD_LOCAL char* _info_texts[MAX_INFO_LINES];
 
 static void resetInfoText() {
 	_info_texts[0] = _song_name;
@@ -131,15 +131,12 @@ static void resetInfoText() {
 
 // ----  abstract base class of all loaders  --------------------------------------------
 
-FileLoader::FileLoader() {
-}
-
 // respective loader singletons:
 #ifdef TEST
-static TestFileLoader	_test_loader;
+static THREAD_LOCAL TestFileLoader	_test_loader;
 #endif
-static SidFileLoader	_sid_loader;
-static MusFileLoader	_mus_loader;
+static THREAD_LOCAL SidFileLoader	_sid_loader;
+static THREAD_LOCAL MusFileLoader	_mus_loader;
 
 
 FileLoader* FileLoader::getInstance(uint32_t is_mus, void* in_buffer, uint32_t in_buf_size) {
@@ -195,12 +192,12 @@ void FileLoader::setNTSCMode(uint8_t is_ntsc) {
 	_ntsc_mode = is_ntsc;
 }
 
-void FileLoader::initTune(uint32_t sample_rate, uint8_t selected_track) {
+uint8_t FileLoader::initTune(uint32_t sample_rate, uint8_t selected_track) {
 	_selected_track = getValidatedTrack(selected_track);
 
 	uint8_t timerDrivenPSID = (!_is_rsid && (FileLoader::getCurrentSongSpeed() == 1));
 
-	Core::startupTune(sample_rate, _selected_track,
+	return Core::startupTune(sample_rate, _selected_track,
 					_is_rsid, timerDrivenPSID, _ntsc_mode, _compatibility, _basic_prog,
 					_free_space, &_init_addr, _load_end_addr, _play_addr);
 }
@@ -241,9 +238,6 @@ void FileLoader::configureSids(uint16_t flags, uint8_t* addr_list) {
 
 #ifdef TEST
 
-TestFileLoader::TestFileLoader() {
-}
-
 static uint16_t loadTestFromMemory(void *buf, uint32_t buflen) {
 	uint8_t *pdata = (uint8_t*)buf;;
     uint8_t data_file_offset = 0;
@@ -265,7 +259,7 @@ static uint16_t loadTestFromMemory(void *buf, uint32_t buflen) {
 }
 
 uint8_t match(const char* test, char* filename) {
-	static char path[128];
+	char path[128];	// tests may be run concurrently (see native/src/websid_test.cpp)
 	snprintf(path, 128, "/websid_test/tests/cpu/%s", test);
 	return !strcmp(filename, path);
 }
@@ -405,7 +399,7 @@ const static uint16_t MUS_MAX_SIZE = MUS_REL_DATA_START;
 const static uint16_t MUS_MAX_SONG_SIZE = 0xA000 - MUS_DATA_START;	// stop at BASIC ROM.. or how big are these songs?
 
 	// buffer used to combine .mus and player
-static uint8_t*			_mus_mem_buffer = 0;							// represents memory at MUS_BASE_ADDR
+static THREAD_LOCAL uint8_t*			_mus_mem_buffer = 0;							// represents memory at MUS_BASE_ADDR
 const static uint16_t	_mus_mem_buffer_size = 0xA000 - MUS_BASE_ADDR;
 
 
@@ -466,9 +460,6 @@ static void musMapInfoTexts(uint8_t* mus_song_file, uint32_t mus_song_file_len,
 	}
 }
 
-MusFileLoader::MusFileLoader() {
-}
-
 // Compute!'s .mus files require an addtional player that must installed with the song file.
 uint16_t MusFileLoader::loadComputeSidplayerData(uint8_t *mus_song_file, uint32_t mus_song_file_len) {
 	// note: the player can also be used in RSID mode (but for some reason the timing is then much slower..)
@@ -555,9 +546,6 @@ uint8_t MusFileLoader::isTrackEnd() {
 
 // ------------------  handling of regular SID format (.sid files) ------------------------------------------------------
 
-SidFileLoader::SidFileLoader() {
-}
-
 static uint16_t loadSIDFromMemory(void* sid_data, uint16_t* load_addr, uint16_t* load_end_addr,
 									uint16_t* init_addr, uint16_t* play_addr, uint8_t* subsongs,
 									uint8_t* startsong, uint32_t* speed, uint32_t file_size,
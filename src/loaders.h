@@ -36,8 +36,10 @@ public:
 
 	/**
 	* Select a specific track in a previsouly loaded song (see "load" API).
+	*
+	* @return 0 if the song's INIT routine did not complete
 	*/
-	void initTune(uint32_t sample_rate, uint8_t selected_track);
+	uint8_t initTune(uint32_t sample_rate, uint8_t selected_track);
 
 	/**
 	* Hook used to detect when a song has played til the end.
@@ -51,9 +53,14 @@ public:
 	static uint8_t getNTSCMode();	
 	static char**  getInfoStrings();
 	static uint8_t getCurrentSongSpeed();
+
+	/**
+	* Manually override original "video mode" setting from music file.
+	*/
+	static void setNTSCMode(uint8_t is_ntsc);
 		
 protected:
-	FileLoader();
+	FileLoader() = default;	// the thread local singletons need a trivial constructor
 	
 	static uint8_t getValidatedTrack(uint8_t selected_track);
 	
@@ -67,11 +74,6 @@ protected:
 	static void storeFileInfo();
 
 	static void setRsidMode(uint8_t is_rsid);
-
-	/**
-	* Manually override original "video mode" setting from music file.
-	*/
-	static void setNTSCMode(uint8_t is_ntsc);
 };
 
 #endif
\ No newline at end of file
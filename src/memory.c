@@ -19,8 +19,8 @@
 
 
 // memory access interfaces provided by other components
-extern uint8_t	sidReadMem(uint16_t addr);
-extern void 	sidWriteMem(uint16_t addr, uint8_t value);
+extern uint8_t	sidReadChip(uint8_t sid_idx, uint16_t addr);
+extern void 	sidWriteChip(uint8_t sid_idx, uint16_t addr, uint8_t value);
 
 extern uint8_t	ciaReadMem(uint16_t addr);
 extern void		ciaWriteMem(uint16_t addr, uint8_t value);
@@ -29,25 +29,106 @@ extern uint8_t	vicReadMem(uint16_t addr);
 extern void		vicWriteMem(uint16_t addr, uint8_t value);
 
 
-uint8_t*		_memory = 0;
+THREAD_LOCAL uint8_t*		_memory = 0;
 
 #define BASIC_SIZE 0x2000
-static uint8_t _basic_rom[BASIC_SIZE];		// mapped to $a000-$bfff
+static THREAD_LOCAL uint8_t _basic_rom[BASIC_SIZE];		// mapped to $a000-$bfff
 
 #define KERNAL_SIZE 0x2000
-static uint8_t _kernal_rom[KERNAL_SIZE];	// mapped to $e000-$ffff
+static THREAD_LOCAL uint8_t _kernal_rom[KERNAL_SIZE];	// mapped to $e000-$ffff
 
 #define IO_AREA_SIZE 0x1000
-static uint8_t _char_rom[IO_AREA_SIZE];		// mapped to $d000-$dfff
+static THREAD_LOCAL uint8_t _char_rom[IO_AREA_SIZE];		// mapped to $d000-$dfff
+
+THREAD_LOCAL uint8_t*		_io_area = 0;				// mapped to $d000-$dfff
+
+// Performance optimization: the device that handles an access to the IO area
+// is directly looked up in this map (instead of narrowing it down via a chain
+// of address comparisons). The granularity used here is the finest that is
+// used for SID chip addresses, i.e. $20 bytes.
+#define IO_SLOT_SHIFT 5
+#define IO_SLOTS (IO_AREA_SIZE >> IO_SLOT_SHIFT)
+
+#define IO_RAM 0	// color RAM, unused areas, etc
+#define IO_VIC 1
+#define IO_CIA 2	// CIA 1 and 2 (the regs are distinguished by ciaReadMem/ciaWriteMem)
+#define IO_SID 3	// IO_SID + n: SID chip #n (#0 is the default $d400 SID)
+
+#define SLOTS_8(d) d, d, d, d, d, d, d, d
+#define SLOTS_32(d) SLOTS_8(d), SLOTS_8(d), SLOTS_8(d), SLOTS_8(d)
+
+// standard C64 layout (also used for any unused mirrors of the SID)
+#define DEFAULT_IO_SLOTS \
+	SLOTS_32(IO_VIC),	/* $d000-$d3ff */ \
+	SLOTS_32(IO_SID),	/* $d400-$d7ff */ \
+	SLOTS_32(IO_RAM),	/* $d800-$dbff */ \
+	SLOTS_8(IO_CIA),	/* $dc00-$dcff */ \
+	SLOTS_8(IO_CIA),	/* $dd00-$ddff */ \
+	SLOTS_8(IO_SID),	/* $de00-$deff: exotic multi-SID scenario */ \
+	SLOTS_8(IO_RAM)		/* $df00-$dfff */
+
+static const uint8_t _default_io_slots[IO_SLOTS] = { DEFAULT_IO_SLOTS };
+static THREAD_LOCAL uint8_t _io_slots[IO_SLOTS] = { DEFAULT_IO_SLOTS };
+
+#define IO_DEVICE(addr) \
+	_io_slots[((addr) - 0xd000) >> IO_SLOT_SHIFT]
+
+void memResetIOMap() {
+	memcpy(_io_slots, _default_io_slots, IO_SLOTS);
+}
+
+void memMapSID(uint16_t addr, uint8_t sid_idx) {
+	if ((addr >= 0xd000) && (addr < 0xe000)) {
+		IO_DEVICE(addr) = IO_SID + sid_idx;
+	}
+}
+
+uint8_t memGetSIDIdx(uint16_t addr) {
+	if ((addr < 0xd000) || (addr >= 0xe000)) return 0;
 
-uint8_t*		_io_area = 0;				// mapped to $d000-$dfff
+	uint8_t device = IO_DEVICE(addr);
+	return device >= IO_SID ? device - IO_SID : 0;
+}
+
+// support for code caching (see block cache in cpu.c): the CPU registers
+// the RAM pages that it has cached information about and the version of a
+// registered page is then bumped when the page is written to (i.e. the
+// respective cached information is outdated and must be updated)
+#define PAGES 256
+THREAD_LOCAL uint8_t*		_page_watched = 0;
+THREAD_LOCAL uint32_t*		_page_version = 0;
+
+#define PAGE_WRITTEN(addr) \
+	do { \
+		const uint8_t page = (addr) >> 8; \
+		if (_page_watched[page]) { \
+			_page_watched[page] = 0; \
+			_page_version[page]++; \
+		} \
+	} while (0)
+
+uint32_t memWatchPage(uint8_t page) {
+	_page_watched[page] = 1;
+	return _page_version[page];
+}
+
+uint32_t memPageVersion(uint8_t page) {
+	return _page_version[page];
+}
+
+static void allPagesWritten() {
+	for (uint32_t i = 0; i < PAGES; i++) {
+		_page_watched[i] = 0;
+		_page_version[i]++;
+	}
+}
 
 
 /*
 * snapshot of c64 memory right after loading..
 * it is restored before playing a new track..
 */
-static uint8_t _memory_snapshot[MEMORY_SIZE];
+static THREAD_LOCAL uint8_t _memory_snapshot[MEMORY_SIZE];
 
 void memSaveSnapshot() {
 	memCopyFromRAM(_memory_snapshot, 0, MEMORY_SIZE);
@@ -62,9 +143,78 @@ uint8_t memMatch(uint16_t addr, uint8_t* pattern, uint8_t len) {
 	return !memcmp(&(_memory[addr]), pattern, len);
 }
 
+/*
+* @return 0 if RAM is visible; 1 if KERNAL ROM is visible
+*/
+#define IS_KERNAL_VISIBLE(bank) \
+	((bank) & 0x2)
+
+/*
+* @return 0 if RAM is visible; 1 if BASIC ROM is visible
+*/
+#define IS_BASIC_VISIBLE(bank) \
+	(((bank) & 0x3) == 3)
+
+/*
+* @return 0 if RAM is visible; 1 if CHAR ROM is visible
+*/
+#define IS_CHARROM_VISIBLE(bank) \
+	(!((bank) & 0x4) && ((bank) & 0x3))
+
+/*
+* @return 0 if RAM/ROM is visible; 1 if IO area is visible
+*/
+#define IS_IO_VISIBLE(bank) \
+	((((bank) & 0x4) != 0) && (((bank) & 0x7) != 0x4))
+
+
+// Performance optimization: instead of decoding the current bank setting
+// for each memory access, each of the 8 possible settings of $01 has its own
+// per-page lookup tables, i.e. the tables must only be switched when $01 is
+// changed. A table entry points to the memory that is visible in the
+// respective page and NULL is used for pages where the IO area is visible.
+#define BANKS 8
+static THREAD_LOCAL uint8_t* _bank_read_pages[BANKS][PAGES];
+static THREAD_LOCAL uint8_t* _bank_write_pages[BANKS][PAGES];
+
+static THREAD_LOCAL uint8_t** _read_pages;		// tables for the current $01 setting
+static THREAD_LOCAL uint8_t** _write_pages;
+
+#define SYNC_BANK() \
+	_read_pages = _bank_read_pages[_memory[0x0001] & 0x7]; \
+	_write_pages = _bank_write_pages[_memory[0x0001] & 0x7];
+
+static void initBankTables() {
+	for (uint32_t bank = 0; bank < BANKS; bank++) {
+		for (uint32_t page = 0; page < PAGES; page++) {
+			uint16_t addr = page << 8;
+			uint8_t* ram = &_memory[addr];
+			uint8_t* rd = ram;
+			uint8_t* wr = ram;	// even if a ROM is visible, writes always go to the RAM
+
+			if ((addr >= 0xa000) && (addr < 0xc000)) {
+				if (IS_BASIC_VISIBLE(bank)) rd = &_basic_rom[addr - 0xa000];
+
+			} else if ((addr >= 0xd000) && (addr < 0xe000)) {
+				if (IS_IO_VISIBLE(bank)) {
+					rd = wr = 0;
+				} else if (IS_CHARROM_VISIBLE(bank)) {
+					rd = &_char_rom[addr - 0xd000];
+				}
+			} else if (addr >= 0xe000) {
+				if (IS_KERNAL_VISIBLE(bank)) rd = &_kernal_rom[addr - 0xe000];
+			}
+			_bank_read_pages[bank][page] = rd;
+			_bank_write_pages[bank][page] = wr;
+		}
+	}
+	SYNC_BANK();
+}
+
 static void setMemBank(uint8_t b) {
 	// note: processor port related functionality (see addr 0x0) is NOT implemented
 	_memory[0x0001] = b;
+	SYNC_BANK();
 	/*
 	// the only song that I am aware of that uses the "processor port direction"
 	// to filter the memory bank settings that it is making is Chocolatebar.sid
@@ -139,29 +289,6 @@ void memResetBanksPSID(uint16_t play_addr) {
 	}
 }
 
-/*
-* @return 0 if RAM is visible; 1 if KERNAL ROM is visible
-*/
-#define IS_KERNAL_VISIBLE() \
-	(_memory[0x0001] & 0x2)
-
-/*
-* @return 0 if RAM is visible; 1 if BASIC ROM is visible
-*/
-#define IS_BASIC_VISIBLE() \
-	((_memory[0x0001] & 0x3) == 3)
-
-/*
-* @return 0 if RAM is visible; 1 if CHAR ROM is visible
-*/
-#define IS_CHARROM_VISIBLE() \
-	!(_memory[0x0001] & 0x4) && (_memory[0x0001] & 0x3)
-
-/*
-* @return 0 if RAM/ROM is visible; 1 if IO area is visible
-*/
-#define IS_IO_VISIBLE() \
-	((_memory[0x0001] & 0x4) != 0) && ((_memory[0x0001] & 0x7) != 0x4)
 
 
 uint8_t memReadIO(uint16_t addr) {
@@ -178,103 +305,74 @@ uint8_t memReadRAM(uint16_t addr) {
 	return _memory[addr];
 }
 void memWriteRAM(uint16_t addr, uint8_t value) {
+	PAGE_WRITTEN(addr);
 	 _memory[addr] = value;
+
+	if (addr == 0x0001) {
+		SYNC_BANK();
+	}
 }
 
 void memCopyToRAM(uint8_t* src, uint16_t dest_addr, uint32_t len) {
+	allPagesWritten();	// not used in any time critical context
 	memcpy(&_memory[dest_addr], src, len);
+	SYNC_BANK();
 }
 void memCopyFromRAM(uint8_t* dest, uint16_t src_addr, uint32_t len) {
 	memcpy(dest, &_memory[src_addr], len);
 }
 
-#define RETURN_RAM_AREA(addr) \
-	return  _memory[addr];
-
+// handling of the IO area in case it is visible
 #define RETURN_IO_AREA(addr) \
-	if (IS_IO_VISIBLE()) { \
-		if (addr < 0xd400) { \
+	const uint8_t device = IO_DEVICE(addr); \
+	switch (device) { \
+		case IO_RAM: \
+			return memReadIO(addr); \
+		case IO_VIC: \
 			return vicReadMem(addr); \
-		} else if (addr < 0xd800) { \
-			return sidReadMem(addr); \
-		} else if ((addr >= 0xdc00) && (addr < 0xde00)) { \
+		case IO_CIA: \
 			return ciaReadMem(addr); \
-		} else if ((addr >= 0xde00) && (addr < 0xdf00)) { /* exotic scenario last*/ \
-			return sidReadMem(addr); \
-		} \
-		return memReadIO(addr); \
-	} else if(IS_CHARROM_VISIBLE()) { \
-		return _char_rom[addr - 0xd000]; \
-	} else { \
-		return _memory[addr]; /* normal RAM access */ \
-	}
-
-#define RETURN_BASIC_AREA(addr) \
-	if (IS_BASIC_VISIBLE()) { \
-		return _basic_rom[addr - 0xa000]; \
-	} else { \
-		return _memory[addr]; /* normal RAM access */ \
-	}
-
-#define RETURN_KERNAL_AREA(addr) \
-	if (IS_KERNAL_VISIBLE()) { \
-		return _kernal_rom[addr - 0xe000]; \
-	} else { \
-		return _memory[addr]; /* normal RAM access */ \
+		default: \
+			return sidReadChip(device - IO_SID, addr); \
 	}
 
 uint8_t memGet(uint16_t addr) {
-	// performance opt: try to identify most often used areas with
-	// least number of comparisons (narrow down from top
-	// or bottom using ONE check per area)
-
 	if (addr < 0xa000) {
-		RETURN_RAM_AREA(addr);
-	} else if (addr >= 0xe000) {
-		// presuming the IRQ/NMI vectors/handlers make this
-		// more often used..
-		RETURN_KERNAL_AREA(addr);
-	} else if ((addr >= 0xd000)) {
-		// presuming that BASIC stuff is less relevant
-		// the IO comes next (not tested)
-		RETURN_IO_AREA(addr);
-	} else if (addr >= 0xc000) {
-		// for the 1000-2000 songs that are located here
-		// one test could be avoided by going straight for
-		// it.. however that would slow down every IO or
-		// kernal access
-		RETURN_RAM_AREA(addr);
-	} else {
-		RETURN_BASIC_AREA(addr);
+		// most often used area: this single check is still cheaper
+		// than the table lookup (which is used for everything else)
+		return _memory[addr];
+	}
+	const uint8_t* page = _read_pages[addr >> 8];
+	if (page) {
+		return page[addr & 0xff];
 	}
+	RETURN_IO_AREA(addr);
 }
 
-// normal RAM or kernal ROM (even if the ROM is visible,
-// writes always go to the RAM) example: Vikings.sid copied
-// player data to BASIC ROM area while BASIC ROM is turned on..
-#define WRITE_RAM(addr, value) \
-	/* if (addr == 0x0001) setMemBank(value); else*//* not worth it! */\
-	_memory[addr] = value;
-
 // normally all writes to IO areas should "write
 // through" to RAM, however PSID garbage does not
 // always seem to tolerate that (see Fighting_Soccer)
-#define WRITE_IO(addr, value) \
-	if (IS_IO_VISIBLE()) { \
-		if (addr < 0xd400) {									/* vic stuff */ \
+#define WRITE_VISIBLE_IO(addr, value) \
+	const uint8_t device = IO_DEVICE(addr); \
+	switch (device) { \
+		case IO_RAM: \
+			_io_area[addr - 0xd000] = value; \
+			break; \
+		case IO_VIC: \
 			vicWriteMem(addr, value); \
-			return; \
-		} else if (((addr >= 0xd400) && (addr < 0xd800)) ||  \
-					((addr >= 0xde00) && (addr < 0xdf00))) {	/* SID stuff */ \
-			sidWriteMem(addr, value); \
-			return; \
-		} else if ((addr >= 0xdc00) && (addr < 0xde00)) {		/* CIA timers */ \
+			break; \
+		case IO_CIA: \
 			ciaWriteMem(addr, value); \
 			/* hack: make sure timer latches can be retrieved from RAM */ \
 			_memory[addr] = value; /* write RAM */ \
-			return; \
-		} \
-		_io_area[addr - 0xd000] = value; \
+			break; \
+		default: \
+			sidWriteChip(device - IO_SID, addr, value); \
+	}
+
+#define WRITE_IO(addr, value) \
+	if (IS_IO_VISIBLE(_memory[0x0001])) { \
+		WRITE_VISIBLE_IO(addr, value); \
 	} else { \
 		_memory[addr] = value; /* write RAM */ \
 	}
@@ -284,12 +382,28 @@ void memSetIO(uint16_t addr, uint8_t value) {
 }
 
 void memSet(uint16_t addr, uint8_t value) {
-	if (addr < 0xd000) {		// this most often used area should need the least comparisons
-		WRITE_RAM(addr, value);
-	} else if (addr < 0xe000) {	// handle I/O area
-		WRITE_IO(addr, value);
+	if (addr < 0xd000) {	// most often used area: no need for a lookup
+		PAGE_WRITTEN(addr);
+		_memory[addr] = value;
+
+		if (addr == 0x0001) {
+			SYNC_BANK();
+		}
+		return;
+	}
+	uint8_t* page = _write_pages[addr >> 8];
+	if (page) {
+		// normal RAM (or RAM below some ROM: even if the ROM is visible, writes
+		// always go to the RAM) example: Vikings.sid copied player data to
+		// BASIC ROM area while BASIC ROM is turned on..
+		PAGE_WRITTEN(addr);
+		page[addr & 0xff] = value;
+
+		if (addr == 0x0001) {
+			SYNC_BANK();	// setMemBank() not worth it.. see processor port
+		}
 	} else {
-		WRITE_RAM(addr, value);
+		WRITE_VISIBLE_IO(addr, value);
 	}
 }
 
@@ -595,8 +709,13 @@ void memRsidMain(uint16_t free_space, uint16_t *init_addr) {
 
 void memResetRAM(uint8_t is_ntsc, uint8_t is_psid) {
 	if (_memory == 0) _memory = (uint8_t*) calloc(1, MEMORY_SIZE);
+	if (_page_watched == 0) _page_watched = (uint8_t*) calloc(PAGES, sizeof(uint8_t));
+	if (_page_version == 0) _page_version = (uint32_t*) calloc(PAGES, sizeof(uint32_t));
+
+	allPagesWritten();
 
     memset(&_memory[0], 0x0, MEMORY_SIZE);
+	initBankTables();
 
 	_memory[0x0314] = 0x31;		// standard IRQ vector
 	_memory[0x0315] = 0xea;
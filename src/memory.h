@@ -37,6 +37,9 @@ void	memWriteRAM(uint16_t addr, uint8_t value);
 uint8_t	memMatch(uint16_t addr, uint8_t* pattern, uint8_t len);
 void	memCopyToRAM(uint8_t* src, uint16_t dest_addr, uint32_t len);
 void	memCopyFromRAM(uint8_t* dest, uint16_t src_addr, uint32_t len);
+	// code caching: the version of a watched page changes when it is written to
+uint32_t memWatchPage(uint8_t page);
+uint32_t memPageVersion(uint8_t page);
 void	memSaveSnapshot();
 void	memRestoreSnapshot();
 
@@ -44,6 +47,10 @@ void	memRestoreSnapshot();
 // I/O area access 
 uint8_t	memReadIO(uint16_t addr);
 void	memWriteIO(uint16_t addr, uint8_t value);
+	// routing of IO area accesses (SID chips are mapped in $20 byte slots)
+void	memResetIOMap();
+void	memMapSID(uint16_t addr, uint8_t sid_idx);
+uint8_t	memGetSIDIdx(uint16_t addr);
 
 // PSID crap
 void	memSetDefaultBanksPSID(uint8_t is_rsid, uint16_t init_addr, uint16_t load_end_addr);
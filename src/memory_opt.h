@@ -61,8 +61,10 @@ extern "C" {
 #endif
 
 // THESE MUST NOT BE USED DIRECTLY!
-extern uint8_t* _io_area;		
-extern uint8_t* _memory;
+extern THREAD_LOCAL uint8_t* _io_area;		
+extern THREAD_LOCAL uint8_t* _memory;
+extern THREAD_LOCAL uint8_t* _page_watched;
+extern THREAD_LOCAL uint32_t* _page_version;
 
 #ifdef __cplusplus
 }
@@ -72,7 +74,17 @@ extern uint8_t* _memory;
 	_memory[addr]
 	
 #define	MEM_WRITE_RAM(addr, value)\
-	_memory[addr] = value;
+	do { \
+		const uint16_t mem_addr = (addr); \
+		if (_page_watched[mem_addr >> 8]) { \
+			_page_watched[mem_addr >> 8] = 0; \
+			_page_version[mem_addr >> 8]++; \
+		} \
+		_memory[mem_addr] = (value); \
+	} while (0)
+
+#define	MEM_PAGE_VERSION(page)\
+	_page_version[page]
 
 #define	MEM_READ_IO(addr)\
 	_io_area[(addr) - 0xd000]
@@ -98,6 +110,9 @@ extern uint8_t* _memory;
 #define	MEM_WRITE_RAM(addr, value)\
 	memWriteRAM((addr), value)
 
+#define	MEM_PAGE_VERSION(page)\
+	memPageVersion(page)
+
 #define	MEM_READ_IO(addr)\
 	memReadIO((addr))
 	
@@ -58,8 +58,6 @@
 
 #include "sid.h"
 #include "envelope.h"
-#include "filter6581.h"
-#include "filter8580.h"
 #include "digi.h"
 #include "wavegenerator.h"
 #include "memory_opt.h"
@@ -67,6 +65,7 @@
 extern "C" {
 #include "base.h"
 #include "memory.h"
+#include "system.h"		// SYS_CYCLES()
 };
 
 
@@ -119,19 +118,16 @@ extern "C" {
 
 // --------- HW configuration ----------------
 
-static uint16_t	_sid_addr[MAX_SIDS];		// start addr of SID chips (0 means NOT available)
-static bool 	_sid_is_6581[MAX_SIDS];		// models of installed SID chips
+static THREAD_LOCAL uint16_t	_sid_addr[MAX_SIDS];		// start addr of SID chips (0 means NOT available)
+static THREAD_LOCAL bool 	_sid_is_6581[MAX_SIDS];		// models of installed SID chips
 
 
-static bool 	_ext_multi_sid;				// use extended multi-sid mode
+static THREAD_LOCAL bool 	_ext_multi_sid;				// use extended multi-sid mode
 
 	// fixme: the original "ext multi-sid" stereo channel assignment has been replaced by the added
 	// regular stereo-panning - remove the below remainders of the old impl
-static uint8_t 	_sid_target_chan[MAX_SIDS];	// output channel for the SID chips
-static uint8_t 	_sid_2nd_chan_idx;			// stereo sid-files: 1st chip using 2nd channel
-
-SIDConfigurator::SIDConfigurator() {
-}
+static THREAD_LOCAL uint8_t 	_sid_target_chan[MAX_SIDS];	// output channel for the SID chips
+static THREAD_LOCAL uint8_t 	_sid_2nd_chan_idx;			// stereo sid-files: 1st chip using 2nd channel
 
 void SIDConfigurator::init(uint16_t* addrs, bool* set_6581, uint8_t* target_chan, uint8_t* second_chan_idx,
 			bool* ext_multi_sid_mode) {
@@ -221,53 +217,47 @@ void SIDConfigurator::configure(uint8_t is_ext_file, uint8_t sid_file_version, u
 			_target_chan[ii] = 0;
 		}
 	}
+
+	// let the memory access directly route IO area accesses to the respective SID
+	memResetIOMap();
+
+	for (uint8_t i= 1; (i<MAX_SIDS) && _addrs[i]; i++) {	// 1st entry is always the regular default SID
+		memMapSID(_addrs[i], i);
+	}
 }
 
-static SIDConfigurator _hw_config;
+static THREAD_LOCAL SIDConfigurator _hw_config;
 
 
-static uint8_t _used_sids = 0;
-static uint8_t _is_audible = 0;
+static THREAD_LOCAL uint8_t _used_sids = 0;
+static THREAD_LOCAL uint8_t _is_audible = 0;
 
-static SID _sids[MAX_SIDS];	// allocate the maximum
+static THREAD_LOCAL SID _sids[MAX_SIDS];	// allocate the maximum (see resetAll())
 
 // globally shared by all SIDs
-static double		_cycles_per_sample;
-static uint32_t		_sample_rate;				// target playback sample rate
+static THREAD_LOCAL double		_cycles_per_sample;
+static THREAD_LOCAL uint32_t		_sample_rate;				// target playback sample rate
 
 
 /**
 * This class represents one specific MOS SID chip.
 */
-SID::SID() {
-	_addr = 0;		// e.g. 0xd400
-
-	_env_generators[0] = new Envelope(this, 0);
-	_env_generators[1] = new Envelope(this, 1);
-	_env_generators[2] = new Envelope(this, 2);
-
-	_wave_generators[0] = new WaveGenerator(this, 0);
-	_wave_generators[1] = new WaveGenerator(this, 1);
-	_wave_generators[2] = new WaveGenerator(this, 2);
-
-	_filter= NULL;
-	setFilterModel(false);	// default to 8580
-
-	_digi = new DigiDetector(this);
+void SID::init() {
+	_digi.init(this);
+	for (uint8_t i= 0; i<3; i++) {
+		_wave_generators[i].init(this, i);
+		_env_generators[i].init(this, i);
+	}
+	_filter.init(this);
 }
 
 void SID::setFilterModel(bool set_6581) {
-	if (!_filter || (set_6581 != _is_6581)) {
-		_is_6581 = set_6581;
-
-		if (_filter) { delete _filter; }
-
-		_filter = _is_6581 ? (Filter*)new Filter6581(this) : (Filter*)new Filter8580(this);
-	}
+	_is_6581 = set_6581;
+	_filter.setModel(_is_6581);
 }
 
 WaveGenerator* SID::getWaveGenerator(uint8_t voice_idx) {
-	return _wave_generators[voice_idx];
+	return &_wave_generators[voice_idx];
 }
 
 void SID::resetEngine(uint32_t sample_rate, bool set_6581, uint32_t clock_rate) {
@@ -279,12 +269,15 @@ void SID::resetEngine(uint32_t sample_rate, bool set_6581, uint32_t clock_rate)
 	_cycles_per_sample = ((double)clock_rate) / sample_rate;	// corresponds to Hermit's clk_ratio
 
 	for (uint8_t i= 0; i<3; i++) {
-		_wave_generators[i]->reset(_cycles_per_sample);
+		_wave_generators[i].reset(_cycles_per_sample);
 	}
 
+	_osc_start_ts = _osc_end_ts = 0;
+	updateWaveGeneratorsMode();
+
 	// reset envelope generator
 	for (uint8_t i= 0; i<3; i++) {
-		_env_generators[i]->reset();
+		_env_generators[i].reset();
 	}
 
 	// reset filter
@@ -292,23 +285,45 @@ void SID::resetEngine(uint32_t sample_rate, bool set_6581, uint32_t clock_rate)
 
 	// reset external filter
 	_left_lp_out= _left_hp_out= 0;
+	_right_lp_out= _right_hp_out= 0;
 }
 
 void SID::clockWaveGenerators() {
 	// forward oscillators one CYCLE (required to properly time HARD SYNC)
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
-		WaveGenerator* wave_gen = _wave_generators[voice_idx];
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 		wave_gen->clockPhase1();
 	}
 
 	// handle oscillator HARD SYNC (quality wise it isn't worth the trouble to
 	// use this correct impl..)
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
-		WaveGenerator* wave_gen = _wave_generators[voice_idx];
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 		wave_gen->clockPhase2();
 	}
 }
 
+void SID::syncWaveGenerators() {
+	// catch up with the cycles that the oscillators have not been clocked for
+	if (_osc_start_ts != _osc_end_ts) {
+		for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+			_wave_generators[voice_idx].clockCycles(_osc_start_ts, _osc_end_ts);
+		}
+		_osc_start_ts = _osc_end_ts;
+	}
+}
+
+void SID::updateWaveGeneratorsMode() {
+	// must be called after any change of the oscillator setup (the oscillators
+	// must already have been synced at that point)
+
+	_osc_batch = 1;
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		_osc_batch &= _wave_generators[voice_idx].isBatchable();
+	}
+	_osc_start_ts = _osc_end_ts;
+}
+
 double SID::getCyclesPerSample() {
 	return _cycles_per_sample;
 }
@@ -341,7 +356,7 @@ uint8_t SID::setSID6581(bool set_6581) {
 // will make for a better user experience in DeepSID when switching players..
 
 static double _vol_map[] = { 1.0f, 0.6f, 0.4f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f };
-static double _vol_scale;
+static THREAD_LOCAL double _vol_scale;
 
 
 uint16_t SID::getBaseAddr() {
@@ -380,7 +395,7 @@ void SID::resetModel(bool set_6581) {
 	}
 
 	setFilterModel(set_6581);
-	_filter->setSampleRate(_sample_rate);
+	_filter.setSampleRate(_sample_rate);
 }
 
 void SID::reset(uint16_t addr, uint32_t sample_rate, bool set_6581, uint32_t clock_rate,
@@ -390,7 +405,13 @@ void SID::reset(uint16_t addr, uint32_t sample_rate, bool set_6581, uint32_t clo
 
 	resetEngine(sample_rate, set_6581, clock_rate);
 
-	_digi->reset(clock_rate, is_rsid, is_compatible);
+	_digi.reset(clock_rate, is_rsid, is_compatible);
+
+	// filter settings of a previously played song must not leak into
+	// songs that do not set them (i.e. when the emulator is reused)
+	for (uint8_t reg= 0x15; reg<0x18; reg++) {
+		poke(reg, 0);
+	}
 
 	// turn on full volume
 	memWriteIO(getBaseAddr() + 0x18, 0xf);
@@ -409,10 +430,10 @@ uint8_t SID::peekMem(uint16_t addr) {
 
 uint8_t SID::readVoiceLevel(uint8_t voice_idx) {
 
-	WaveGenerator* wave_gen = _wave_generators[voice_idx];
-	bool is_muted = wave_gen->isMuted() || _filter->isSilencedVoice3(voice_idx);
+	WaveGenerator* wave_gen = &_wave_generators[voice_idx];
+	bool is_muted = wave_gen->isMuted() || _filter.isSilencedVoice3(voice_idx);
 
-	return is_muted ? 0 : _env_generators[voice_idx]->getOutput();
+	return is_muted ? 0 : _env_generators[voice_idx].getOutput();
 }
 
 uint8_t SID::readMem(uint16_t addr) {
@@ -420,10 +441,11 @@ uint8_t SID::readMem(uint16_t addr) {
 
 	switch (offset) {
 	case 0x1b:	// "oscillator" .. docs once again are wrong since this is WF specific!
-		return _wave_generators[2]->getOsc();
+		syncWaveGenerators();
+		return _wave_generators[2].getOsc();
 
 	case 0x1c:	// envelope
-		return _env_generators[2]->getOutput();
+		return _env_generators[2].getOutput();
 	}
 
 	// reading of "write only" registers returns whatever has been last
@@ -442,9 +464,11 @@ void SID::poke(uint8_t reg, uint8_t val) {
     else if (reg <= 13) { voice_idx = 1; reg -= 7; }
     else if (reg <= 20) { voice_idx = 2; reg -= 14; }
 
+	syncWaveGenerators();
+
 	// writes that impact the envelope generator
 	if ((reg >= 0x4) && (reg <= 0x6)) {
-		_env_generators[voice_idx]->poke(reg, val);
+		_env_generators[voice_idx].poke(reg, val);
 	}
 
 	// writes that impact the filter
@@ -452,10 +476,10 @@ void SID::poke(uint8_t reg, uint8_t val) {
 		case 0x15:
 		case 0x16:
 		case 0x17:
-			_filter->poke(reg, val);
+			_filter.poke(reg, val);
 			break;
 		case 0x18:
-			_filter->poke(reg, val);
+			_filter.poke(reg, val);
 
 			_volume = (val & 0xf);
 			break;
@@ -463,28 +487,31 @@ void SID::poke(uint8_t reg, uint8_t val) {
 
     switch (reg) {
         case 0x0: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setFreqLow(val);
+			updateWaveGeneratorsMode();
             break;
         }
         case 0x1: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setFreqHigh(val);
+			updateWaveGeneratorsMode();
             break;
         }
         case 0x2: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setPulseWidthLow(val);
             break;
         }
         case 0x3: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setPulseWidthHigh(val);
             break;
         }
         case 0x4: {
-			WaveGenerator *wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setWave(val);
+			updateWaveGeneratorsMode();
 
 			break;
 		}
@@ -500,7 +527,7 @@ extern void recordPokeSID(uint32_t ts, uint8_t reg, uint8_t value);
 #endif
 
 void SID::writeMem(uint16_t addr, uint8_t value) {
-	_digi->detectSample(addr, value);
+	_digi.detectSample(addr, value);
 	_bus_write = value;
 
 	// no reason anymore to NOT always write (unlike old/un-synced version)
@@ -536,10 +563,20 @@ void SID::writeMem(uint16_t addr, uint8_t value) {
 }
 
 void SID::clock() {
-	clockWaveGenerators();		// for all 3 voices
+	if (_osc_batch) {
+		// just record the cycle (see syncWaveGenerators())
+		const uint32_t now = SYS_CYCLES();
+		if (now != _osc_end_ts) {	// some cycles have not been clocked (see sysClockOpt())
+			syncWaveGenerators();
+			_osc_start_ts = now;
+		}
+		_osc_end_ts = now + 1;
+	} else {
+		clockWaveGenerators();		// for all 3 voices
+	}
 
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
-		_env_generators[voice_idx]->clockEnvelope();
+		_env_generators[voice_idx].clockEnvelope();
 	}
 }
 
@@ -563,20 +600,21 @@ const int32_t _clip_value = 32767;
 
 
 void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l, int32_t *s_r) {
+	syncWaveGenerators();
 
 	int32_t vout[3];	// outputs of the 3 voices
 
 	// digi sample add-on
 	int32_t dvoice_idx;
 	int32_t digi_out = 0;
-	int8_t digi_override= _digi->useOverrideDigiSignal(&digi_out, &dvoice_idx);
+	int8_t digi_override= _digi.useOverrideDigiSignal(&digi_out, &dvoice_idx);
 
 	// create output sample based on current SID state
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
 
-		WaveGenerator* wave_gen = _wave_generators[voice_idx];
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 
-		bool is_muted = wave_gen->isMuted() || _filter->isSilencedVoice3(voice_idx);
+		bool is_muted = wave_gen->isMuted() || _filter.isSilencedVoice3(voice_idx);
 
 		if (is_muted) {
 			if (digi_override && (dvoice_idx == voice_idx)) {
@@ -596,15 +634,15 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 			}
 
 		} else {
-			uint8_t env_out = _env_generators[voice_idx]->getOutput();
-			int32_t outv = ((wave_gen)->*(wave_gen->getOutput))(); // crappy C++ syntax for calling the "getOutput" method
+			uint8_t env_out = _env_generators[voice_idx].getOutput();
+			int32_t outv = wave_gen->getOutput();
 
 			// note: the _wf_zero ofset *always* creates some wave-output that will be modulated via the
 			// envelope (even when 0-waveform is set it will cause audible clicks and distortions in
 			// the scope views)
 
 			int32_t o = _vol_scale * ( env_out * (outv + _wf_zero) + _dac_offset);
-			vout[voice_idx]= _filter->getVoiceOutput(voice_idx, &o);
+			vout[voice_idx]= _filter.getVoiceOutput(voice_idx, &o);
 
 			// trace output (always make it 16-bit)
 			if (synth_trace_bufs) {
@@ -615,7 +653,7 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 
 				// the ">>8" should correctly be "/255" - but the faster but incorrect impl should be adequate here
 				o = env_out * (outv - 0x8000) >> 8;	// make sure the scope is nicely centered
-				*(voice_trace_buffer + offset) = (int16_t)_filter->getVoiceScopeOutput(voice_idx, &o);
+				*(voice_trace_buffer + offset) = (int16_t)_filter.getVoiceScopeOutput(voice_idx, &o);
 			}
 		}
 	}
@@ -630,7 +668,7 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 	int32_t final_sample_l;
 	int32_t final_sample_r;
 
-	if(_digi->isMahoney()) {
+	if(_digi.isMahoney()) {
 		// hack: directly output the digi to avoid distortions caused by the low sample rate..
 		// testcase: Acid_Flashback.sid
 
@@ -645,8 +683,8 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 	APPLY_EXTERNAL_FILTER_L(final_sample_l);
 	APPLY_EXTERNAL_FILTER_R(final_sample_r);
 
-	final_sample_l = _digi->genPsidSample(final_sample_l);		// recorded PSID digis are merged in directly
-	final_sample_r = _digi->genPsidSample(final_sample_r);		// recorded PSID digis are merged in directly
+	final_sample_l = _digi.genPsidSample(final_sample_l);		// recorded PSID digis are merged in directly
+	final_sample_r = _digi.genPsidSample(final_sample_r);		// recorded PSID digis are merged in directly
 
 	*s_l = final_sample_l;
 	*s_r = final_sample_r;
@@ -658,14 +696,16 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 void SID::synthSampleStripped(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l, int32_t *s_r) {
 	int32_t vout[3];
 
+	syncWaveGenerators();
+
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
 
-		uint8_t env_out = _env_generators[voice_idx]->getOutput();
-		WaveGenerator *wave_gen= _wave_generators[voice_idx];
-		int32_t outv = ((wave_gen)->*(wave_gen->getOutput))(); // crappy C++ syntax for calling the "getOutput" method
+		uint8_t env_out = _env_generators[voice_idx].getOutput();
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
+		int32_t outv = wave_gen->getOutput();
 
 		int32_t o = _vol_scale * ( env_out * (outv + _wf_zero) + _dac_offset);
-		vout[voice_idx]= _filter->getVoiceOutput(voice_idx, &o);
+		vout[voice_idx]= _filter.getVoiceOutput(voice_idx, &o);
 
 		// trace output (always make it 16-bit)
 		if (synth_trace_bufs) {
@@ -696,23 +736,23 @@ void SID::synthSampleStripped(int16_t** synth_trace_bufs, uint32_t offset, int32
 
 // "friends only" accessors
 uint8_t SID::getWave(uint8_t voice_idx) {
-	return _wave_generators[voice_idx]->getWave();
+	return _wave_generators[voice_idx].getWave();
 }
 
 uint16_t SID::getFreq(uint8_t voice_idx) {
-	return _wave_generators[voice_idx]->getFreq();
+	return _wave_generators[voice_idx].getFreq();
 }
 
 uint16_t SID::getPulse(uint8_t voice_idx) {
-	return _wave_generators[voice_idx]->getPulse();
+	return _wave_generators[voice_idx].getPulse();
 }
 
 uint8_t SID::getAD(uint8_t voice_idx) {
-	return _env_generators[voice_idx]->getAD();
+	return _env_generators[voice_idx].getAD();
 }
 
 uint8_t SID::getSR(uint8_t voice_idx) {
-	return _env_generators[voice_idx]->getSR();
+	return _env_generators[voice_idx].getSR();
 }
 
 uint32_t SID::getSampleFreq() {
@@ -720,38 +760,32 @@ uint32_t SID::getSampleFreq() {
 }
 
 DigiType  SID::getDigiType() {
-	return _digi->getType();
+	return _digi.getType();
 }
 
 const char*  SID::getDigiTypeDesc() {
-	return _digi->getTypeDesc();
+	return _digi.getTypeDesc();
 }
 
 uint16_t  SID::getDigiRate() {
-	return _digi->getRate();
+	return _digi.getRate();
 }
 
 void SID::setMute(uint8_t voice_idx, uint8_t is_muted) {
 	if (voice_idx > 3) voice_idx = 3; 	// no more than 4 voices per SID (volume as 4th "voice")
 
 	if (voice_idx == 3) {
-		_digi->setEnabled(!is_muted);
+		_digi.setEnabled(!is_muted);
 
 	} else {
-		_wave_generators[voice_idx]->setMute(is_muted);
+		_wave_generators[voice_idx].setMute(is_muted);
 	}
 }
 
 void SID::resetStatistics() {
-	_digi->resetCount();
+	_digi.resetCount();
 }
 
-/**
-* Use a simple map to later find which IO access matches which SID (saves annoying if/elses later):
-*/
-const int MEM_MAP_SIZE = 0xbff;
-static uint8_t _mem2sid[MEM_MAP_SIZE];	// maps memory area d400-dfff to available SIDs
-
 void SID::setMute(uint8_t sid_idx, uint8_t voice_idx, uint8_t is_muted) {
 	if (sid_idx > 9) sid_idx = 9; 	// no more than 10 sids supported
 
@@ -892,8 +926,6 @@ void SID::resetAll(uint32_t sample_rate, uint32_t clock_rate, uint8_t is_rsid,
 		}
 	}
 
-	memset(_mem2sid, 0, MEM_MAP_SIZE); // default is SID #0
-
 	_is_audible = 0;
 
 //	if (_ext_multi_sid) {
@@ -902,15 +934,18 @@ void SID::resetAll(uint32_t sample_rate, uint32_t clock_rate, uint8_t is_rsid,
 		_vol_scale = _vol_map[_used_sids - 1] / 0xff;	// 0xff serves to normalize the 8-bit envelope
 //	}
 
-	// setup the configured SID chips & make map where to find them
+	// the SIDs have no constructor (see THREAD_LOCAL) and their helpers are
+	// only wired up here
+	for (uint8_t i= 0; i<MAX_SIDS; i++) {
+		_sids[i].init();
+	}
+
+	// setup the configured SID chips (see SIDConfigurator::configure() for the
+	// respective mapping of the IO area)
 
 	for (uint8_t i= 0; i<_used_sids; i++) {
 		SID &sid = _sids[i];
 		sid.reset(_sid_addr[i], sample_rate, _sid_is_6581[i], clock_rate, is_rsid, is_compatible);	// stereo only used for my extended sid-file format
-
-		if (i) {	// 1st entry is always the regular default SID
-			memset((void*)(_mem2sid + _sid_addr[i] - 0xd400), i, 0x1f);
-		}
 	}
 }
 void SID::initPanning(float *panPerSID) {
@@ -948,7 +983,7 @@ uint8_t SID::isExtMultiSidMode() {
 
 // gets what has actually been last written (even for write-only regs)
 uint8_t SID::peek(uint16_t addr) {
-	uint8_t sid_idx = _mem2sid[addr - 0xd400];
+	uint8_t sid_idx = memGetSIDIdx(addr);
 	return _sids[sid_idx].peekMem(addr);
 }
 
@@ -959,14 +994,20 @@ extern "C" uint8_t sidReadVoiceLevel(uint8_t sid_idx, uint8_t voice_idx) {
 	return _sids[sid_idx].readVoiceLevel(voice_idx);
 }
 
-extern "C" uint8_t sidReadMem(uint16_t addr) {
-	uint8_t sid_idx = _mem2sid[addr - 0xd400];
+extern "C" uint8_t sidReadChip(uint8_t sid_idx, uint16_t addr) {
 	return _sids[sid_idx].readMem(addr);
 }
 
-extern "C" void sidWriteMem(uint16_t addr, uint8_t value) {
+extern "C" void sidWriteChip(uint8_t sid_idx, uint16_t addr, uint8_t value) {
 	_is_audible |= value;	// detect use by the song
 
-	uint8_t sid_idx = _mem2sid[addr - 0xd400];
 	_sids[sid_idx].writeMem(addr, value);
+}
+
+extern "C" uint8_t sidReadMem(uint16_t addr) {
+	return sidReadChip(memGetSIDIdx(addr), addr);
+}
+
+extern "C" void sidWriteMem(uint16_t addr, uint8_t value) {
+	sidWriteChip(memGetSIDIdx(addr), addr, value);
 }
\ No newline at end of file
@@ -21,8 +21,6 @@ extern "C" {
 */
 class SIDConfigurator {
 public:
-	SIDConfigurator();
-	
 	void configure(uint8_t is_ext_file, uint8_t sid_file_version, uint16_t flags, uint8_t* addr_list);
 protected:
 	void init(uint16_t* addrs, bool* set_6581, uint8_t* target_chan, uint8_t* second_chan_idx,
@@ -42,10 +40,10 @@ private:
 };
 
 
-class Envelope;
-class DigiDetector;
-class WaveGenerator;
-class Filter;
+#include "wavegenerator.h"
+#include "envelope.h"
+#include "filter.h"
+#include "digi.h"
 
 
 /**
@@ -53,11 +51,12 @@ class Filter;
 *
 * Some aspects of the implementation are delegated to separate helpers,
 * see digi.h, envelope.h, filter.h
+*
+* The helpers are embedded, i.e. each SID is one contiguous block of memory
+* (its start is aligned to a cache line).
 */
-class SID {
+class alignas(64) SID {
 public:
-	SID();
-	
 	/**
 	* Gets the base memory address that this SID is mapped to.
 	*/
@@ -242,8 +241,11 @@ private:
 	*/
 	static void	setModels(const bool* set_6581);
 	
+	void		init();		// wires up the embedded helpers
 	void		resetEngine(uint32_t sample_rate, bool set_6581, uint32_t clock_rate);
 	void		clockWaveGenerators();
+	void		syncWaveGenerators();
+	void		updateWaveGeneratorsMode();
 	
 protected:
 	bool			_is_6581;
@@ -257,11 +259,17 @@ protected:
 	float			_pan_left[3];
 	float			_pan_right[3];
 	
-	DigiDetector*	_digi;
+	DigiDetector	_digi;
 private:
-	WaveGenerator*	_wave_generators[3];
-	Envelope*		_env_generators[3];
-	Filter*			_filter;
+	WaveGenerator	_wave_generators[3];
+	Envelope		_env_generators[3];
+	Filter			_filter;
+
+	// performance optimization: while possible the oscillators are only
+	// clocked when they are actually observed (see syncWaveGenerators())
+	uint8_t			_osc_batch;
+	uint32_t		_osc_start_ts;	// first cycle that has not been clocked yet
+	uint32_t		_osc_end_ts;	// first cycle that has not been "recorded" yet
 	
 	uint16_t		_addr;			// start memory address that the SID is mapped to
 
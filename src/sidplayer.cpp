@@ -52,33 +52,33 @@ extern "C" void		sidSetPanning(uint8_t sid_idx, uint8_t voice_idx, float panning
 
 #include "loaders.h"
 
-static FileLoader*	_loader;
+static THREAD_LOCAL FileLoader*	_loader;
 
 
 // ------ stereo postprocessing ---------------------
 	// variable settings
-static int32_t _effect_level = -1; // stereo disabled by default;	16384=low 32767=LVCS_EFFECT_HIGH
-static LVM_UINT16 _reverb_level = 100;
-static LVCS_SpeakerType_en _speaker_type= LVCS_HEADPHONES; // LVCS_EX_HEADPHONES
+static THREAD_LOCAL int32_t _effect_level = -1; // stereo disabled by default;	16384=low 32767=LVCS_EFFECT_HIGH
+static THREAD_LOCAL LVM_UINT16 _reverb_level = 100;
+static THREAD_LOCAL LVCS_SpeakerType_en _speaker_type= LVCS_HEADPHONES; // LVCS_EX_HEADPHONES
 
 	// base lib data types
-static LVCS_Handle_t _lvcs_handle = LVM_NULL;	// just a typecast PTR to be later set to the above instance
-static LVCS_MemTab_t _lvcs_mem_tab;
-static LVCS_Capabilities_t _lvcs_caps;
-static LVCS_Params_t _lvcs_params;
+static THREAD_LOCAL LVCS_Handle_t _lvcs_handle = LVM_NULL;	// just a typecast PTR to be later set to the above instance
+static THREAD_LOCAL LVCS_MemTab_t _lvcs_mem_tab;
+static THREAD_LOCAL LVCS_Capabilities_t _lvcs_caps;
+static THREAD_LOCAL LVCS_Params_t _lvcs_params;
 
 
 // --------- audio output buffer management ------------------------
 
 // WebAudio side processor buffer size
-static uint32_t _procBufSize = 0;
+static THREAD_LOCAL uint32_t _procBufSize = 0;
 
 // keep it down to one screen to allow for
 // more direct feedback to WebAudio side:
 #define BUFLEN 96000/50
 #define CHANNELS 2
 
-static int16_t 		_soundBuffer[BUFLEN * CHANNELS];
+static THREAD_LOCAL int16_t 		_soundBuffer[BUFLEN * CHANNELS];
 
 // max 10 sids*4 voices (1 digi channel)
 #define MAX_SIDS 			10
@@ -86,27 +86,31 @@ static int16_t 		_soundBuffer[BUFLEN * CHANNELS];
 #define MAX_SCOPE_BUFFERS 	40
 
 // output "scope" streams corresponding to final audio buffer
-static int16_t* 	_scope_buffers[MAX_SCOPE_BUFFERS];
+static THREAD_LOCAL int16_t* 	_scope_buffers[MAX_SCOPE_BUFFERS];
 
 // these buffers are "per frame" i.e. 1 screen refresh, e.g. 822 samples
-static int16_t* 	_synth_buffer = 0;
-static int16_t** 	_synth_trace_buffers = 0;
+static THREAD_LOCAL int16_t* 	_synth_buffer = 0;
+static THREAD_LOCAL uint16_t 	_synth_buffer_size = 0;	// allocated size (in samples)
+static THREAD_LOCAL int16_t** 	_synth_trace_buffers = 0;
 
-static uint16_t 	_chunk_size; 	// number of samples per call
+static THREAD_LOCAL uint16_t 	_chunk_size; 	// number of samples per call
 
-static uint32_t 	_number_of_samples_rendered = 0;
-static uint32_t 	_number_of_samples_to_render = 0;
+static THREAD_LOCAL uint32_t 	_number_of_samples_rendered = 0;
+static THREAD_LOCAL uint32_t 	_number_of_samples_to_render = 0;
 
-static uint8_t	 	_sound_started;
-static uint8_t	 	_skip_silence_loop;
+static THREAD_LOCAL uint8_t	 	_sound_started;
+static THREAD_LOCAL uint8_t	 	_skip_silence_loop;
+static THREAD_LOCAL uint32_t		_emulated_samples;		// playback position (since playTune)
+static THREAD_LOCAL uint16_t		_warp_tod_samples;		// samples warped since the last TOD update
 
-static uint32_t		_sample_rate;
+static THREAD_LOCAL uint32_t		_sample_rate;
 
-static uint32_t		_trace_sid = 0;
-static uint8_t		_ready_to_play = 0;
+static THREAD_LOCAL uint32_t		_trace_sid = 0;
+static THREAD_LOCAL uint8_t		_ready_to_play = 0;
+static THREAD_LOCAL uint8_t		_init_timeout = 0;		// PSID INIT of the current track did not complete
 
 
-static float 	_panning[] = {	// panning per SID/voice (max 10 SIDs..)
+static THREAD_LOCAL float 	_panning[] = {	// panning per SID/voice (max 10 SIDs..)
 	0.5, 0.4, 0.6,
 	0.5, 0.6, 0.4,
 	0.5, 0.4, 0.6,
@@ -209,13 +213,13 @@ extern "C" void setPanning(uint8_t sid_idx, uint8_t voice_idx, float panning) {
 #define REGS2RECORD (25 + 3)	// only the first 25 regs (trailing paddle regs (etc) are ignored) - but adding "envelope levels" of all three voices
 
 
-static uint8_t** _sidRegSnapshots = 0;
-static uint32_t _sidSnapshotSmplCount = 0;
-static uint32_t _sidSnapshotToggle = 0;
+static THREAD_LOCAL uint8_t** _sidRegSnapshots = 0;
+static THREAD_LOCAL uint32_t _sidSnapshotSmplCount = 0;
+static THREAD_LOCAL uint32_t _sidSnapshotToggle = 0;
 
-static uint16_t _sidRegSnapshotAlloc = 0;
-static uint32_t _sidRegSnapshotPos = 0;
-static uint16_t _sidRegSnapshotMax = 0;
+static THREAD_LOCAL uint16_t _sidRegSnapshotAlloc = 0;
+static THREAD_LOCAL uint32_t _sidRegSnapshotPos = 0;
+static THREAD_LOCAL uint16_t _sidRegSnapshotMax = 0;
 
 
 static void initSidRegSnapshotBuffers() {
@@ -246,6 +250,8 @@ static void initSidRegSnapshotBuffers() {
 extern "C" uint16_t getSIDRegister(uint8_t sidIdx, uint16_t reg) __attribute__((noinline));
 
 static void recordSidRegSnapshot() {
+	if (!_sidRegSnapshotMax) return;	// procBufSize 0: nobody is interested in snapshots (e.g. headless rendering)
+
 	uint32_t offset = _sidRegSnapshotPos * REGS2RECORD;
 	for (uint8_t i = 0; i < SID::getNumberUsedChips(); i++) {
 		uint8_t* sidBuf = &(_sidRegSnapshots[i][offset]);
@@ -333,10 +339,14 @@ static void resetScopeBuffers() {
 }
 
 static void resetSynthBuffer(uint16_t size) {
+	// reuse the existing buffer when possible (a player typically plays many songs)
+	if (_synth_buffer && (_synth_buffer_size >= size)) return;
+
 	if (_synth_buffer) free(_synth_buffer);
 
 	_synth_buffer= (int16_t*)malloc(sizeof(int16_t)*
 						(size * CHANNELS + 1));
+	_synth_buffer_size = size;
 }
 
 static void discardSynthTraceBuffers() {
@@ -406,6 +416,8 @@ static void resetAudioBuffers() {
 
 extern "C" uint8_t envSetNTSC(uint8_t is_ntsc)  __attribute__((noinline));
 extern "C" uint8_t EMSCRIPTEN_KEEPALIVE envSetNTSC(uint8_t is_ntsc) {
+	FileLoader::setNTSCMode(is_ntsc);	// also used by the next playTune()
+
 	resetTimings(is_ntsc);
 	resetAudioBuffers();
 
@@ -451,6 +463,7 @@ extern "C" int32_t EMSCRIPTEN_KEEPALIVE computeAudioSamples() {
 
 				Core::runOneFrame(is_simple_sid_mode, speed, _synth_buffer,
 									_synth_trace_buffers, _chunk_size);
+				_emulated_samples += _chunk_size;
 
 				if (!_sound_started) {
 					if (SID::isAudible()) {
@@ -522,6 +535,65 @@ extern "C" int32_t EMSCRIPTEN_KEEPALIVE computeAudioSamples() {
 }
 
 
+// Fast forward without any audio output (see Core::warpOneFrame): unlike the
+// limited silence skipping in computeAudioSamples() this runs until done, i.e.
+// it may block for a while (which is OK for native/server side use).
+static uint32_t warp(uint32_t samples, uint8_t until_audible) {
+	if(!_ready_to_play) return 0;
+
+	uint8_t is_simple_sid_mode =	!FileLoader::isExtendedSidFile();
+	uint8_t speed =					FileLoader::getCurrentSongSpeed();
+
+	// whatever is left from the last frame is outdated now
+	_number_of_samples_to_render = 0;
+
+	uint32_t skipped = 0;
+	while (skipped < samples) {
+		uint16_t n = (samples - skipped) < _chunk_size ? (samples - skipped) : _chunk_size;
+		uint16_t done = Core::warpOneFrame(is_simple_sid_mode, n, until_audible);
+
+		skipped += done;
+
+		// like during regular playback the TOD is updated once per _chunk_size samples
+		_warp_tod_samples += done;
+		if (_warp_tod_samples >= _chunk_size) {
+			_warp_tod_samples -= _chunk_size;
+			Core::updateTOD(speed);
+		}
+
+		if ((done < n) || _loader->isTrackEnd()) break;
+	}
+	_emulated_samples += skipped;
+
+	if (SID::isAudible()) _sound_started = 1;	// no need to skip anything in computeAudioSamples()
+
+	return skipped;
+}
+
+static uint32_t samplesToMillis(uint32_t samples) {
+	return (uint32_t)(((double)samples) * 1000 / _sample_rate);
+}
+
+// Fast forwards to the specified playback position (in milliseconds since playTune)
+// e.g. for seeking; use playTune() to go backwards. Returns the number of
+// skipped milliseconds.
+extern "C" uint32_t warpTo(uint32_t ms) __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE warpTo(uint32_t ms) {
+	uint32_t target = (uint32_t)(((double)ms) * _sample_rate / 1000);
+
+	if (target <= _emulated_samples) return 0;
+
+	return samplesToMillis(warp(target - _emulated_samples, 0));
+}
+
+// Fast forwards to the point where the song's output first becomes audible (but
+// at most max_ms), e.g. to skip the lengthy silent intro of some BASIC songs.
+// Returns the number of skipped milliseconds.
+extern "C" uint32_t skipSilence(uint32_t max_ms) __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE skipSilence(uint32_t max_ms) {
+	return samplesToMillis(warp((uint32_t)(((double)max_ms) * _sample_rate / 1000), 1));
+}
+
 extern "C" uint32_t enableVoice(uint8_t sid_idx, uint8_t voice, uint8_t on)  __attribute__((noinline));
 extern "C" uint32_t EMSCRIPTEN_KEEPALIVE enableVoice(uint8_t sid_idx, uint8_t voice, uint8_t on) {
 	SID::setMute(sid_idx, voice, !on);
@@ -638,6 +710,8 @@ extern "C" uint32_t EMSCRIPTEN_KEEPALIVE playTune(uint32_t selected_track, uint3
 	_procBufSize = (float) procBufSize;
 
 	_sound_started = 0;
+	_emulated_samples = 0;
+	_warp_tod_samples = 0;
 
 	// note: crappy BASIC songs like Baroque_Music_64_BASIC take 100sec before
 	// they even start playing.. unfortunately the emulation is NOT fast enough
@@ -658,7 +732,7 @@ extern "C" uint32_t EMSCRIPTEN_KEEPALIVE playTune(uint32_t selected_track, uint3
 	// the respective C64 side driver so that users of the emulator do not need
 	// to handle this potentially long running emu scenario (see SID callbacks
 	// triggered on Raspberry SID device).
-	_loader->initTune(_sample_rate, selected_track);
+	_init_timeout = !_loader->initTune(_sample_rate, selected_track);
 
 	SID::initPanning(_effect_level >= 0 ? _panning : _no_panning);
 
@@ -697,6 +771,13 @@ extern "C" uint32_t EMSCRIPTEN_KEEPALIVE loadSidFile(uint32_t is_mus, void* in_b
 	return result;
 }
 
+// returns 1 if the INIT routine of the track started by the last playTune() did
+// not complete (the track is still played - which may or may not work)
+extern "C" uint8_t isInitTimeout() __attribute__((noinline));
+extern "C" uint8_t EMSCRIPTEN_KEEPALIVE isInitTimeout() {
+	return _init_timeout;
+}
+
 extern "C" char** getMusicInfo() __attribute__((noinline));
 extern "C" char** EMSCRIPTEN_KEEPALIVE getMusicInfo() {
 	return FileLoader::getInfoStrings();
@@ -835,6 +916,21 @@ extern "C" double* EMSCRIPTEN_KEEPALIVE getCutoff6581(int slice) {
 	return Filter6581::getCutoff6581(slice);
 }
 
+extern "C" void setFixedPointFilter(uint8_t on) __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setFixedPointFilter(uint8_t on) {
+	Filter::setFixedPoint(on);
+}
+
+extern "C" uint8_t isFixedPointFilter() __attribute__((noinline));
+extern "C" uint8_t EMSCRIPTEN_KEEPALIVE isFixedPointFilter() {
+	return Filter::isFixedPoint();
+}
+
+extern "C" uint32_t loadCombinedWaveforms(void* in_buffer, uint32_t in_buf_size) __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE loadCombinedWaveforms(void* in_buffer, uint32_t in_buf_size) {
+	return WaveGenerator::loadCombinedWaveforms((const uint8_t*)in_buffer, in_buf_size);
+}
+
 
 
 
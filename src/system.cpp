@@ -20,6 +20,7 @@ extern "C" {
 #include <emscripten.h>
 #else
 #include <cstdio>
+#include <time.h>
 #endif
 
 // if PSID 'init' subroutine takes longer than 4 secs then something
@@ -30,10 +31,29 @@ extern "C" {
 
 // ----------- system clock -----------
 
-uint32_t _cycles = 0;		// counter of elapsed cycles
+THREAD_LOCAL uint32_t _cycles = 0;		// counter of elapsed cycles
+
+	// cycles that the CPU has already been run for (see sysClockEvents())
+static THREAD_LOCAL uint32_t _cpu_ahead = 0;
 
 extern "C" void sysReset() {
+	// lazy timer counters/raster position are based on the old clock
+	ciaSyncCounters();
+	vicSyncClock();
 	_cycles = 0;
+	_cpu_ahead = 0;
+}
+
+// the cycle-by-cycle functions may be used after the CPU has been run ahead by
+// sysClockEvents(), e.g. when Core::setEventScheduler(0) or Core::setPerfStats()
+// is used in the middle of a song: the CPU then must skip the cycles that it has
+// already been run for until the other chips have caught up
+static inline void cpuClockCaughtUp() {
+	if (_cpu_ahead) {
+		_cpu_ahead--;
+	} else {
+		cpuClock();
+	}
 }
 
 extern "C" uint32_t sysCycles() {
@@ -41,7 +61,7 @@ extern "C" uint32_t sysCycles() {
 }
 
 extern "C" uint8_t sysClockTimeout() {
-	cpuClock();
+	cpuClockCaughtUp();
 
 	if (sysCycles() >= CYCLELIMIT ) {
 #ifdef EMSCRIPTEN
@@ -66,7 +86,7 @@ extern "C" void sysClockOpt() {
 	if (SID::isAudible()) {
 		SID::clockAll();
 	}
-	cpuClock();
+	cpuClockCaughtUp();
 
 	_cycles += 1;
 }
@@ -75,11 +95,200 @@ extern "C" void sysClock() {
 	vicClock();
 	ciaClock();
 	SID::clockAll();
-	cpuClock();
+	cpuClockCaughtUp();
 
 	_cycles += 1;
 }
 
+// Event driven alternative to calling sysClockOpt()/sysClock() for each cycle:
+// most of the time VIC, CIA and CPU are just counting down to their next
+// event (e.g. a raster line change, a timer underflow, the cycle in which an
+// instruction actually is executed) and all the cycles before the earliest
+// of these events can be skipped in one go. The event cycle itself is then
+// run normally, i.e. the result is exactly the same as for the cycle-by-cycle
+// emulation. (The SID still needs to be clocked for each cycle.)
+// Similarly, while VIC and CIA are idle, the CPU may skip the cycle-by-cycle
+// handling of instruction sequences that cannot interact with them (see
+// cpuRunBlocks()). Since such a sequence can neither affect the SID, it may
+// also extend beyond the requested "cycles", i.e. the CPU then is ahead of the
+// other chips and it is not clocked again until they have caught up (also see
+// cpuClockCaughtUp()). This allows idle loops to be fast-forwarded up to the
+// next VIC or CIA event, e.g. the next IRQ, instead of just to the end of the
+// current sample.
+
+// benchmark support: the instances used while profiling additionally measure the
+// time spent in SID::clockAll() (see sysClockEventsProfiled())
+static void sidClockProfiled();
+
+template <uint8_t IS_PROFILED>
+static inline void sidClock() {
+	if (IS_PROFILED) {
+		sidClockProfiled();
+	} else {
+		SID::clockAll();
+	}
+}
+
+// Performance optimization: the clocking functions that are used for a specific
+// song are known in advance (see vicClock, ciaClock, cpuClock function pointers)
+// and there is a specialized instance of the clocking loop for each of the
+// commonly used combinations, i.e. the compiler can use direct calls instead of
+// going through the function pointers in every cycle.
+template <void (*VIC_CLOCK)(), void (*CIA_CLOCK)(), void (*CPU_CLOCK)(), uint8_t IS_PROFILED>
+static void clockEvents(uint32_t cycles, uint8_t is_opt) {
+	uint8_t is_sid_clocked = !is_opt || SID::isAudible();
+
+	// the CPU only starts a new countdown when it fetches an instruction
+	// (or when it is interrupted by some other event), i.e. it is pointless
+	// to ask for events after each cycle
+	uint8_t is_check = 1;
+
+	while (cycles) {
+		uint32_t quiet = 0;	// cycles before the next event
+		uint8_t is_block = 0;
+
+		if (_cpu_ahead) {
+			// the CPU already has run these cycles but the VIC and CIA might need them
+			// (e.g. a block may have ended by acknowledging a CIA interrupt)
+			quiet = _cpu_ahead;
+			uint32_t e = vicCyclesToEvent() - 1;
+			if (e < quiet) quiet = e;
+			e = ciaCyclesToEvent() - 1;
+			if (e < quiet) quiet = e;
+			if (quiet > cycles) quiet = cycles;
+
+			if (quiet) {
+				_cpu_ahead -= quiet;
+				is_block = 1;
+			} else {
+				VIC_CLOCK();
+				CIA_CLOCK();
+				if (is_sid_clocked) {
+					sidClock<IS_PROFILED>();
+				}
+				_cpu_ahead--;
+				_cycles += 1;
+				cycles--;
+				continue;
+			}
+		} else if (is_check) {
+			quiet = cpuCyclesToEvent() - 1;
+
+			if (quiet) {
+				uint32_t e = vicCyclesToEvent() - 1;
+				if (e < quiet) quiet = e;
+				e = ciaCyclesToEvent() - 1;
+				if (e < quiet) quiet = e;
+
+				if (quiet > cycles) quiet = cycles;
+
+			} else if (CPU_IS_FETCHING()) {
+				// while VIC and CIA are idle the CPU may run complete
+				// blocks of instructions in one go
+				uint32_t b = cpuBlockCycles();
+				if (b) {
+					uint32_t e = vicCyclesToEvent() - 1;
+					uint32_t c = ciaCyclesToEvent() - 1;
+					if (c < e) e = c;
+
+					if (b <= e) {
+						quiet = cpuRunBlocks(e);
+						is_block = 1;
+
+						if (quiet > cycles) {
+							_cpu_ahead = quiet - cycles;
+							quiet = cycles;
+						}
+					}
+				}
+			}
+		}
+
+		if (quiet) {
+			vicSkip(quiet);
+			ciaSkip(quiet);
+			if (!is_block) cpuSkip(quiet);
+
+			if (is_sid_clocked) {
+				for (uint32_t i = 0; i < quiet; i++) {
+					sidClock<IS_PROFILED>();
+					_cycles += 1;	// SID may use the timestamp
+				}
+			} else {
+				_cycles += quiet;
+			}
+			cycles -= quiet;
+			is_check = 1;	// the event may be VIC's or CIA's
+		} else {
+			is_check = CPU_IS_FETCHING();
+
+			// same as sysClockOpt()/sysClock()
+			VIC_CLOCK();
+			CIA_CLOCK();
+			if (is_sid_clocked) {
+				sidClock<IS_PROFILED>();
+			}
+			CPU_CLOCK();
+
+			_cycles += 1;
+			cycles--;
+
+			if (is_opt) is_sid_clocked = SID::isAudible();	// the CPU may have changed that
+		}
+	}
+}
+
+// fallback for any other combination
+static void vicClockAny() { vicClock(); }
+static void ciaClockAny() { ciaClock(); }
+static void cpuClockAny() { cpuClock(); }
+
+typedef void (*clock_events_t)(uint32_t cycles, uint8_t is_opt);
+
+static THREAD_LOCAL clock_events_t _clock_events = 0;
+static THREAD_LOCAL clock_events_t _clock_events_profiled = 0;
+
+	// the configuration that _clock_events was selected for
+static THREAD_LOCAL void (*_selected_vic_clock)() = 0;
+static THREAD_LOCAL void (*_selected_cia_clock)() = 0;
+static THREAD_LOCAL void (*_selected_cpu_clock)() = 0;
+
+#define SELECT_CLOCK_EVENTS(vic, cia, cpu) \
+	_clock_events = &clockEvents<vic, cia, cpu, 0>; \
+	_clock_events_profiled = &clockEvents<vic, cia, cpu, 1>
+
+static void selectClockEvents() {
+	_selected_vic_clock = vicClock;
+	_selected_cia_clock = ciaClock;
+	_selected_cpu_clock = cpuClock;
+
+	if ((vicClock == &vicClockRSID) && (ciaClock == &ciaClockRSID) && (cpuClock == &cpuClockRSID)) {
+		SELECT_CLOCK_EVENTS(vicClockRSID, ciaClockRSID, cpuClockRSID);
+
+	} else if ((vicClock == &vicClockDisabledPSID) && (ciaClock == &ciaClockTimerPSID) && (cpuClock == &cpuClockPSID)) {
+		SELECT_CLOCK_EVENTS(vicClockDisabledPSID, ciaClockTimerPSID, cpuClockPSID);	// timer driven PSID
+
+	} else if ((vicClock == &vicClockPSID) && (ciaClock == &ciaClockRasterPSID) && (cpuClock == &cpuClockPSID)) {
+		SELECT_CLOCK_EVENTS(vicClockPSID, ciaClockRasterPSID, cpuClockPSID);	// raster driven PSID
+
+	} else {
+		SELECT_CLOCK_EVENTS(vicClockAny, ciaClockAny, cpuClockAny);
+	}
+}
+
+static void syncClockEvents() {
+	// the configuration only changes when a song is (re)started
+	if ((vicClock != _selected_vic_clock) || (ciaClock != _selected_cia_clock) ||
+			(cpuClock != _selected_cpu_clock)) {
+		selectClockEvents();
+	}
+}
+
+extern "C" void sysClockEvents(uint32_t cycles, uint8_t is_opt) {
+	syncClockEvents();
+	_clock_events(cycles, is_opt);
+}
+
 extern "C" uint32_t sysGetClockRate(uint8_t is_ntsc) {
 	// note: on the real HW the system clock originates from
 	// VIC chip (see comments in vic.c)
@@ -91,6 +300,76 @@ extern "C" uint32_t sysGetClockRate(uint8_t is_ntsc) {
 	}
 }
 
+// ----------- benchmark support -----------
+
+extern "C" double sysTimeSecs() {
+#ifdef EMSCRIPTEN
+	return emscripten_get_now() / 1000;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+#endif
+}
+
+// reading the clock takes about as long as one SID::clockAll() call.. measuring
+// each call would therefore completely distort the result, i.e. only every
+// PROFILE_SAMPLING-th call is measured and the result is extrapolated
+#define PROFILE_SAMPLING 16
+
+static THREAD_LOCAL double _timer_overhead = -1;
+
+static double calibrateTimer() {
+	const int n = 1000;
+	double start = sysTimeSecs();
+	for (int i= 0; i<n; i++) {
+		sysTimeSecs();
+	}
+	return (sysTimeSecs() - start) / n;
+}
+
+	// time spent in SID::clockAll() since the last reset (see sidClockProfiled())
+static THREAD_LOCAL double _sid_clock_secs = 0;
+
+static void sidClockProfiled() {
+	if (_cycles % PROFILE_SAMPLING) {
+		SID::clockAll();
+	} else {
+		if (_timer_overhead < 0) _timer_overhead = calibrateTimer();
+
+		double start = sysTimeSecs();
+		SID::clockAll();
+		double secs = sysTimeSecs() - start - _timer_overhead;
+		if (secs > 0) _sid_clock_secs += secs * PROFILE_SAMPLING;
+	}
+}
+
+// same as sysClockOpt()/sysClock() but additionally returns the (estimated) time
+// spent in SID::clockAll() - which cannot be measured from the outside
+extern "C" double sysClockProfiled(uint8_t is_opt) {
+	_sid_clock_secs = 0;
+
+	vicClock();
+	ciaClock();
+	if (!is_opt || SID::isAudible()) {
+		sidClockProfiled();
+	}
+	cpuClockCaughtUp();
+
+	_cycles += 1;
+	return _sid_clock_secs;
+}
+
+// same for sysClockEvents()
+extern "C" double sysClockEventsProfiled(uint32_t cycles, uint8_t is_opt) {
+	_sid_clock_secs = 0;
+
+	syncClockEvents();
+	_clock_events_profiled(cycles, is_opt);
+
+	return _sid_clock_secs;
+}
+
 #ifdef TEST
 extern "C" uint8_t sysClockTest() {
 	sysClock();
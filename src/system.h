@@ -27,13 +27,25 @@ uint8_t		sysClockTest();
 #endif
 uint32_t	sysGetClockRate(uint8_t is_ntsc);
 
+// event driven clocking: the components report in how many cycles their
+// next "event" is due (1: the very next cycle must be run normally) and
+// the cycles in between are skipped in one go
+#define NO_EVENT 0xffffffff
+
+void		sysClockEvents(uint32_t cycles, uint8_t is_opt);
+
+// benchmark support (see native/src/websid_bench.cpp)
+double		sysTimeSecs();		// monotonic wall clock
+double		sysClockProfiled(uint8_t is_opt);
+double		sysClockEventsProfiled(uint32_t cycles, uint8_t is_opt);
+
 
 
 // -------------------- performance optimization --------------------------
 
 
 #ifdef OPT_USE_INLINE_ACCESS
-extern uint32_t _cycles; 	// MUST NOT BE USED DIRECTLY
+extern THREAD_LOCAL uint32_t _cycles; 	// MUST NOT BE USED DIRECTLY
 
 #define SYS_CYCLES() \
 	_cycles
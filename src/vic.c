@@ -38,6 +38,8 @@
 
 #include "vic.h"
 
+#include <string.h>
+
 #include "memory.h"
 #include "memory_opt.h"
 #include "cpu.h"
@@ -46,46 +48,70 @@
 #include "system.h"	// only needed for PSID optimization
 
 
-static double _fps;
-static uint8_t _cycles_per_raster;
-static uint16_t _lines_per_screen;
+static THREAD_LOCAL double _fps;
+static THREAD_LOCAL uint8_t _cycles_per_raster;
+static THREAD_LOCAL uint16_t _lines_per_screen;
+
+static THREAD_LOCAL uint8_t _x;	// in cycles
+static THREAD_LOCAL uint16_t _y;	// in rasters
 
-static uint8_t _x;	// in cycles
-static uint16_t _y;	// in rasters
+// performance optimization RSID: the raster position is not updated for each
+// cycle but only when it is actually needed (see syncPosition()), i.e. _x/_y
+// reflect the position after the clocking of cycle _pos_ts
+static THREAD_LOCAL uint32_t _pos_ts;
+static THREAD_LOCAL uint32_t _clocked_ts;		// first cycle that has not been clocked yet
+static THREAD_LOCAL uint32_t _next_event_ts;	// next cycle that needs regular clocking
 
 // performance optimization PSID
-static uint32_t _cycles_per_screen;
-static uint32_t _cycles_next_irq_PSID;
+static THREAD_LOCAL uint32_t _cycles_per_screen;
+static THREAD_LOCAL uint32_t _cycles_next_irq_PSID;
 
-static uint8_t _signal_irq;	// redundant to (memReadIO(0xd019) & 0x80)
+static THREAD_LOCAL uint8_t _signal_irq;	// redundant to (memReadIO(0xd019) & 0x80)
 
-static uint8_t _badline_den;
+// use this whenever "_signal_irq" is updated.. (the CPU is notified of the IRQ line)
+#define SIGNAL_IRQ(value) \
+	_signal_irq = value; \
+	cpuSetIRQLine(IRQ_SRC_VIC, _signal_irq)
 
-static uint32_t _raster_latch;	// optimization: D012 + D011-bit 8 combined
+static THREAD_LOCAL uint8_t _badline_den;
+static THREAD_LOCAL uint8_t _badline_map[40];	// 1 bit per raster line of the current frame
 
-static uint8_t (*_stunFunc)(uint8_t x, uint16_t y, uint8_t cpr);
+THREAD_LOCAL uint8_t _vic_stun;	// see vicStunCPU()
 
-// default impl
-static uint8_t intBadlineStun(uint8_t x, uint16_t y, uint8_t cpr) {
-	if (_badline_den) {	
-		// note: caching the yscroll related state (see &0x7 below) actually makes
-		// songs like Spijkerhoek 3 run 10% slower! bad idea!
-		
-		if ((y >= 0x30) && (y <= 0xf7) && ((MEM_READ_IO(0xd011) & 0x7) == (y & 0x7))) {
-			if ((x >= 11) && (x <= 53)) {
-				if ((x >= 14)) {
-					return 2;	// stun completely
-				} else {
-					return 1;	// stun on read
-				}
-			}
+static THREAD_LOCAL uint32_t _raster_latch;	// optimization: D012 + D011-bit 8 combined
+
+static THREAD_LOCAL uint8_t (*_stunFunc)(uint8_t x, uint16_t y, uint8_t cpr);
+
+#define IS_BADLINE(y) \
+	(_badline_map[(y) >> 3] & (1 << ((y) & 0x7)))
+
+// stun phase within a badline
+#define STUN_MODE(x) \
+	(((x) >= 11) && ((x) <= 53) ? ((x) >= 14 ? 2 : 1) : 0)	/* 2: stun completely, 1: stun on read */
+
+// the badlines of a frame only depend on the DEN flag and YSCROLL, i.e. they
+// only need to be recalculated when either of them changes (rather than
+// checking the condition for each cycle)
+static void updateBadlineMap() {
+	memset(_badline_map, 0, sizeof(_badline_map));
+
+	if (_badline_den) {
+		// lines 0x30-0xf7 where the lower 3 bits match YSCROLL
+		const uint8_t mask = 1 << (memReadIO(0xd011) & 0x7);
+		for (uint8_t i = (0x30 >> 3); i <= (0xf7 >> 3); i++) {
+			_badline_map[i] = mask;
 		}
 	}
-	return 0;
+}
+
+// default impl
+static uint8_t intBadlineStun(uint8_t x, uint16_t y, uint8_t cpr) {
+	return IS_BADLINE(y) ? STUN_MODE(x) : 0;
 }
 
 void vicSetStunImpl(uint8_t (*f)(uint8_t x, uint16_t y, uint8_t cpr)) {
 	_stunFunc= f;
+	_next_event_ts = _clocked_ts;	// re-evaluate in next cycle
 }
 uint8_t (*vicGetStunImpl(void))(uint8_t, uint16_t, uint8_t) { // crappy C syntax
 	return _stunFunc;
@@ -124,6 +150,8 @@ void vicSetModel(uint8_t ntsc_mode) {
 	// init to very end so that next clock will create a raster 0 IRQ...
 	_x = _cycles_per_raster - 1;
 	_y = _lines_per_screen - 1;
+	_pos_ts = _clocked_ts - 1;
+	_next_event_ts = _clocked_ts;
 	
 	// clocks per frame: NTSC: 17095 - PAL: 19656		
 }
@@ -139,7 +167,7 @@ void vicSetModel(uint8_t ntsc_mode) {
 		 \
 		uint8_t interrupt_enable = MEM_READ_IO(0xd01a) & 0x1; \
 		if (interrupt_enable) { \
-			_signal_irq = 0x80; \
+			SIGNAL_IRQ(0x80); \
 			latch |= 0x80;	/* signal VIC interrupt */  \
 		} \
 		 \
@@ -147,27 +175,98 @@ void vicSetModel(uint8_t ntsc_mode) {
 	}
 
 
-// vicClock function pointer
-void (*vicClock)();
-	
-void vicClockRSID() {
-	_x += 1;
-	
-	if ((_x == 1) && !_y) {	// special case: in line 0 it is cycle 1		
+// brings _x/_y up to date for the specified cycle
+static void syncPosition(uint32_t ts) {
+	uint32_t x = _x + (ts - _pos_ts);
+	_pos_ts = ts;
+
+	if (x >= _cycles_per_raster) {
+		const uint32_t lines = x / _cycles_per_raster;
+		x -= lines * _cycles_per_raster;
+		_y = (_y + lines) % _lines_per_screen;
+	}
+	_x = x;
+}
+
+// cycles from raster position "pos" to the next occurrence of position "target"
+static uint32_t cyclesTo(uint32_t pos, uint32_t target) {
+	return (target > pos) ? target - pos : target + _cycles_per_screen - pos;
+}
+
+// @return first badline after line y within the current frame (or 0 if there is none)
+static uint16_t nextBadline(uint16_t y) {
+	if (_badline_den) {
+		for (uint16_t i = (y < 0x30) ? 0x30 : y + 1; i <= 0xf7; i++) {
+			if (IS_BADLINE(i)) return i;
+		}
+	}
+	return 0;
+}
+
+// handles the raster position reached in cycle "now" and determines when the
+// next relevant position is reached: the line that may trigger a raster IRQ,
+// the start of the next frame and the stun phase of badlines (in between,
+// there is nothing to do but to count cycles)
+static void clockEvent(uint32_t now) {
+	syncPosition(now);
+
+	if ((_x == 1) && !_y) {	// special case: in line 0 it is cycle 1
 		CHECK_IRQ();
-		
+
 		_badline_den = MEM_READ_IO(0xd011) & 0x10;	// default for new frame
-		
-	} else if (_x >= _cycles_per_raster) {
-		_x = 0;
-		_y += 1;
+		updateBadlineMap();
 
-		if (_y >= _lines_per_screen) {
-			_y = 0;			
+	} else if (!_x && _y) {	// normal case: check in cycle 0
+		CHECK_IRQ();
+	}
+
+	if (_stunFunc != &intBadlineStun) {
+		// hacks may depend on anything and are checked for each cycle
+		_vic_stun = _stunFunc(_x, _y, _cycles_per_raster);
+		_next_event_ts = now + 1;
+		return;
+	}
+
+	const uint32_t pos = _y * _cycles_per_raster + _x;
+	uint32_t cycles = cyclesTo(pos, 1);	// next frame
+
+	if (_raster_latch < _lines_per_screen) {
+		uint32_t c = cyclesTo(pos, _raster_latch ? _raster_latch * _cycles_per_raster : 1);
+		if (c < cycles) cycles = c;
+	}
+
+	if (IS_BADLINE(_y) && (_x <= 53)) {
+		_vic_stun = STUN_MODE(_x);
+
+		uint32_t c = (_x < 11) ? 11 - _x : 1;	// each cycle of the stun phase
+		if (c < cycles) cycles = c;
+	} else {
+		_vic_stun = 0;
+
+		uint16_t y = nextBadline(_y);
+		if (y) {
+			uint32_t c = cyclesTo(pos, y * _cycles_per_raster + 11);
+			if (c < cycles) cycles = c;
 		}
-				
-		if (_y) { CHECK_IRQ(); }	// normal case: check in cycle 0				
 	}
+	_next_event_ts = now + cycles;
+}
+
+#define SYNC_POSITION() \
+	if (vicClock == &vicClockRSID) { \
+		syncPosition(_clocked_ts - 1); \
+	}
+
+// vicClock function pointer
+THREAD_LOCAL void (*vicClock)();
+
+void vicClockRSID() {
+	const uint32_t now = SYS_CYCLES();
+
+	if ((int32_t)(now - _next_event_ts) >= 0) {	// timestamps wrap around
+		clockEvent(now);
+	}
+	_clocked_ts = now + 1;
 }
 
 // PSID performance optimization: disable what isn't used anyway
@@ -181,10 +280,10 @@ void vicClockPSID() {
 	// still more expensive than the old emulator since it is checked
 	// every cycle.. but cheaper than correct handling.. as long as 
 	// PSID does no D012 or D011 polling, this should be OK
-	if (SYS_CYCLES() >= _cycles_next_irq_PSID) {
+	if ((int32_t)(SYS_CYCLES() - _cycles_next_irq_PSID) >= 0) {
 		_cycles_next_irq_PSID = SYS_CYCLES() + _cycles_per_screen;
 		
-		_signal_irq = 0x80;
+		SIGNAL_IRQ(0x80);
 		MEM_WRITE_IO(0xd019, 0x81);
 	}
 }
@@ -193,6 +292,35 @@ uint8_t vicIRQ() {
 	return _signal_irq; // memReadIO(0xd019) & 0x80;
 }
 
+// event scheduling (see sysClockEvents()): see clockEvent()
+uint32_t vicCyclesToEvent() {
+	const uint32_t now = SYS_CYCLES();
+
+	if (vicClock == &vicClockRSID) {
+		const int32_t cycles = (int32_t)(_next_event_ts - now);
+		return (cycles > 0) ? (uint32_t)cycles + 1 : 1;
+
+	} else if (vicClock == &vicClockPSID) {
+		const int32_t cycles = (int32_t)(_cycles_next_irq_PSID - now);
+		return (cycles > 0) ? (uint32_t)cycles + 1 : 1;
+	}
+	return NO_EVENT;	// vicClockDisabledPSID
+}
+
+void vicSkip(uint32_t cycles) {
+	if (vicClock == &vicClockRSID) {
+		_clocked_ts = SYS_CYCLES() + cycles;
+	}
+}
+
+void vicSyncClock() {
+	SYNC_POSITION();
+
+	_pos_ts = _clocked_ts = 0;
+	_pos_ts -= 1;			// i.e. the cycle before 0
+	_next_event_ts = _clocked_ts;
+}
+
 /*
  "A Bad Line Condition is given at any arbitrary clock cycle, if at
  the negative edge of ø0 at the beginning of the cycle RASTER >= $30
@@ -228,7 +356,7 @@ uint8_t vicIRQ() {
  depend on it: Vicious_SID_2-15638Hz.sid, Fantasmolytic_tune_2).
 */
 uint8_t vicStunCPU() {
-	return _stunFunc(_x, _y, _cycles_per_raster);		
+	return _vic_stun;	// see clockEvent()
 }
 
 static void cacheRasterLatch() {
@@ -239,6 +367,7 @@ void vicReset(uint8_t is_rsid, uint8_t ntsc_mode) {
 	
 	vicClock = &vicClockRSID;	// default
 	_stunFunc = &intBadlineStun;
+	_vic_stun = 0;
 	
 	vicSetModel(ntsc_mode); 
 	
@@ -247,7 +376,7 @@ void vicReset(uint8_t is_rsid, uint8_t ntsc_mode) {
 	// presumable "the machine" has been running for more than 
 	// one frame before the prog is run (raster has already fired)
 	memWriteIO(0xd019, 0x01);
-	_signal_irq= 0;
+	SIGNAL_IRQ(0);
 	
 	memWriteIO(0xd01a, 0x00); 	// raster irq not active
 	
@@ -259,9 +388,10 @@ void vicReset(uint8_t is_rsid, uint8_t ntsc_mode) {
 		memWriteIO(0xd011, 0x1B);
 		memWriteIO(0xd012, 0x0); 	// raster must be below 0x100
 		
-		_cycles_next_irq_PSID = 0; // trigger it right away
+		_cycles_next_irq_PSID = SYS_CYCLES(); // trigger it right away
 	}
 	_badline_den = 1;	// see d011-defaults above
+	updateBadlineMap();
 	
 	cacheRasterLatch();
 }
@@ -272,6 +402,9 @@ void vicSetDefaultsPSID(uint8_t timerDrivenPSID) {
 	// on (actually another one of those UNDEFINED features - that
 	// "need not to be documented")
 		
+	SYNC_POSITION();	// position is frozen from now on
+	_vic_stun = 0;
+
 	if (timerDrivenPSID) {
 //		memWriteIO(0xd019, 0x81);	// no need since not active before
 		vicClock = &vicClockDisabledPSID;
@@ -305,7 +438,7 @@ static void writeD019(uint8_t value) {
 		v &= 0x7f; 	// all sources are gone: IRQ flag should also be cleared
 	}
 	
-	_signal_irq = v & 0x80;	
+	SIGNAL_IRQ(v & 0x80);
 	memWriteIO(0xd019, v);
 }
 
@@ -316,7 +449,7 @@ static void writeD01A(uint8_t value) {
 		// check if RASTER condition has already fired previously
 		uint8_t d = memReadIO(0xd019);
 		if (d & 0x1) {
-			_signal_irq = 0x80;	
+			SIGNAL_IRQ(0x80);
 			memWriteIO(0xd019, d | 0x80); 	// signal VIC interrupt
 		}
 	}
@@ -325,6 +458,8 @@ static void writeD01A(uint8_t value) {
 void vicWriteMem(uint16_t addr, uint8_t value) {
 	switch (addr) {
 		case 0xd011: {
+			SYNC_POSITION();
+
 			const uint8_t new_den = value & 0x10;
 			
 			// badlineCondition: "..if the DEN bit was set during an
@@ -340,10 +475,12 @@ void vicWriteMem(uint16_t addr, uint8_t value) {
 			}
 			memWriteIO(addr, value);
 			cacheRasterLatch();
+			updateBadlineMap();
 		}
 		case 0xd012:
 			memWriteIO(addr, value);
 			cacheRasterLatch();
+			_next_event_ts = _clocked_ts;	// re-evaluate in next cycle
 			break;
 		case 0xd019:
 			writeD019(value);
@@ -359,8 +496,10 @@ void vicWriteMem(uint16_t addr, uint8_t value) {
 uint8_t vicReadMem(uint16_t addr) {
 	switch (addr) {
 		case 0xd011:
+			SYNC_POSITION();
 			return (memReadIO(0xd011) & 0x7f) | ((_y & 0x100) >> 1);
-		case 0xd012:					
+		case 0xd012:
+			SYNC_POSITION();
 			return  _y & 0xff;
 		case 0xd019:
 			return memReadIO(0xd019);
@@ -19,7 +19,15 @@ void 		vicSetDefaultsPSID(uint8_t timerDrivenPSID);
 
 // clocking
 //void		vicClock();
-extern void (*vicClock)();		// vicClock function pointer (crappy C requires different syntax here)
+extern THREAD_LOCAL void (*vicClock)();		// vicClock function pointer (crappy C requires different syntax here)
+void		vicClockRSID();		// the different vicClock implementations
+void		vicClockPSID();
+void		vicClockDisabledPSID();
+
+// event scheduling (see sysClockEvents())
+uint32_t	vicCyclesToEvent();	// 1 = the next vicClock() must be run
+void		vicSkip(uint32_t cycles);
+void		vicSyncClock();		// must be called before the system clock is reset
 
 // CPU interactions
 uint8_t		vicStunCPU();	// 0: no stun; 1: allow "bus write"; 2: stun
@@ -37,4 +45,19 @@ uint8_t		vicReadMem(uint16_t addr);
 void		vicSetStunImpl(uint8_t (*f)(uint8_t x, uint16_t y, uint8_t cpr));
 uint8_t		(*vicGetStunImpl(void))(uint8_t, uint16_t, uint8_t);
 
+
+// -------------------- performance optimization --------------------------
+
+#ifdef OPT_USE_INLINE_ACCESS
+extern THREAD_LOCAL uint8_t _vic_stun;	// MUST NOT BE USED DIRECTLY
+
+#define VIC_STUN_CPU() \
+	_vic_stun
+
+#else
+
+#define VIC_STUN_CPU() \
+	vicStunCPU()
+#endif
+
 #endif
\ No newline at end of file
@@ -27,6 +27,7 @@ extern "C" {
 #include "system.h"		// SYS_CYCLES()
 }
 #include "wavegenerator.h"
+#include "combinedwf.h"
 
 // waveform control register flags
 	// other flags
@@ -46,49 +47,27 @@ extern "C" {
 const double SCALE_12_16 = ((double)0xffff) / 0xfff;
 #endif
 
-/**
-* This utility class keeps the precalculated "combined waveform" lookup tables.
-*
-* There is no point keeping these in each SID instance (since they are the same anyway)
-*/
-class WaveformTables {
-public:
-	WaveformTables();
-private:
-	static void createCombinedWF(double* wfarray, double bitmul, double bitstrength, double threshold);
-public:
-	// Hermit's precalculated "combined waveforms"
-	double TriSaw_8580[4096];
-	double PulseSaw_8580[4096];
-	double PulseTri_8580[4096];			// Hermit's use of PulseSaw_8580 does not convince in Last_Ninja
-	double PulseTriSaw_8580[4096];
-};
-
-WaveformTables::WaveformTables() {
-    createCombinedWF(TriSaw_8580, 		0.8, 2.4, 0.64);
-    createCombinedWF(PulseSaw_8580, 	1.4, 1.9, 0.68);
-	createCombinedWF(PulseTriSaw_8580, 	0.8, 2.5, 0.64);
-	// far from "correct" but at least a bit better than Hermit's use of PulseSaw_8580 (see Last_Ninja)
-    createCombinedWF(PulseTri_8580, 	0.8, 1.5, 0.38);	// improved settings are welcome!
-}
-
-void WaveformTables::createCombinedWF(double* wfarray, double bitmul, double bitstrength, double threshold) {
-	// Hermit: "I found out how the combined waveform works (neighboring bits affect each other recursively)"
-	for (uint16_t i = 0; i < 4096; i++) {
-		wfarray[i] = 0; //neighbour-bit strength and DAC MOSFET threshold is approximately set by ears'n'trials
-		for (uint8_t j = 0; j < 12; j++) {
-			double bitlevel = 0;
-			for (uint8_t k = 0; k < 12; k++) {
-				bitlevel += (bitmul / pow(bitstrength, abs(k - j))) * (((i >> k) & 1) - 0.5);
-			}
-			wfarray[i] += (bitlevel >= threshold) ? pow(2.0, (double)j) : 0;
-		}
-		wfarray[i] *= 12;
+// Hermit's precalculated "combined waveform" lookup tables (there is no point keeping
+// these in each SID instance since they are the same anyway - but like the rest of the
+// emulator's state the selection is specific to the calling thread, see context.h)
+static THREAD_LOCAL const struct CombinedWaveforms* _wave_table = &DEFAULT_COMBINED_WAVEFORMS;
+
+static THREAD_LOCAL struct CombinedWaveforms _loaded_wave_table;		// see loadCombinedWaveforms()
+
+uint8_t WaveGenerator::loadCombinedWaveforms(const uint8_t* buf, uint32_t len) {
+	if (!buf) {
+		_wave_table = &DEFAULT_COMBINED_WAVEFORMS;
+		return 0;
+	}
+	if (len != sizeof(struct CombinedWaveforms)) return 1;
+	uint16_t* dest = (uint16_t*)&_loaded_wave_table;
+	for (uint32_t i= 0; i<len/2; i++) {
+		dest[i] = buf[2*i] | (buf[2*i + 1] << 8);	// little endian
 	}
+	_wave_table = &_loaded_wave_table;
+	return 0;
 }
 
-static WaveformTables _wave_table;		// only need one instance of this
-
 
 // ----------------------- utils -----------------------------
 
@@ -134,9 +113,9 @@ static WaveformTables _wave_table;		// only need one instance of this
 	_ref0_ts = _ref1_ts = SYS_CYCLES();\
 	_noiseout_sum = 0;
 
-#define OVERSAMPLE_NOISE_OUTPUT(out) \
-	_noiseout_sum += (SYS_CYCLES() - _ref1_ts) * out; \
-	_ref1_ts = SYS_CYCLES(); /* track interval that has already been handled */
+#define OVERSAMPLE_NOISE_OUTPUT(out, ts) \
+	_noiseout_sum += (ts - _ref1_ts) * out; \
+	_ref1_ts = ts; /* track interval that has already been handled */
 
 
 #define INIT_NOISE_OVERSAMPLING(old_noise_bit, new_noise_bit) \
@@ -153,7 +132,7 @@ static WaveformTables _wave_table;		// only need one instance of this
 		 \
 		/* issue: this uses only 1-sample resolution and the anti-aliasing */ \
 		/* used for some WFs might cause problems here.. */ \
-		_noiseout = ((this)->*(this->getOutput))();	/* maybe a separate var should rather be used to not cause confusion.. */ \
+		_noiseout = getOutput();	/* maybe a separate var should rather be used to not cause confusion.. */ \
 	}
 
 
@@ -187,7 +166,7 @@ void WaveGenerator::refillNoiseShiftRegister() {
 	uint32_t trigger_in = _trigger_noise_shift; \
 	if (_noise_bit) {	/* technically incorrect optimization: ignore noise while not used */ \
 		if (_trigger_noise_shift && (--_trigger_noise_shift == 0)) { \
-			shiftNoiseRegisterNoTestBit(); \
+			shiftNoiseRegisterNoTestBit(SYS_CYCLES()); \
 		} else if ((_counter & 0x080000) > (prev_counter & 0x080000)) { \
 			_trigger_noise_shift = 2; /* delay actual shifting by 2 cycles */ \
 		} \
@@ -276,7 +255,7 @@ void WaveGenerator::feedbackNoise(uint16_t out) {
 	_noise_LFSR &= COMBINED_NOISE_MASK | feedback;	// feed back into shift register
 }
 
-void WaveGenerator::shiftNoiseRegisterNoTestBit() {
+void WaveGenerator::shiftNoiseRegisterNoTestBit(uint32_t ts) {
 	// "regular" shifting of noise register while test-bit is not set (triggered "within
 	// SID clocking" by accumulator bit transition - with a 2 cycle delay):
 
@@ -288,7 +267,7 @@ void WaveGenerator::shiftNoiseRegisterNoTestBit() {
 	// in the shiftregister and the noise waveform output is extracted from the bits of the
 	// shift register (i.e. can theoretically be cancelled via setting the test-bit).
 
-	OVERSAMPLE_NOISE_OUTPUT(_noiseout);
+	OVERSAMPLE_NOISE_OUTPUT(_noiseout, ts);
 
 	// shift of the register should correctly have happended 1 cycle earlier using some
 	// separate latch, i.e. the latch would have accepted combined-WF feedback but the
@@ -341,7 +320,7 @@ void WaveGenerator::shiftNoiseRegisterTestBitDriven(const uint8_t new_ctrl) {
 		feedbackNoise(o);
 	}
 */
-	OVERSAMPLE_NOISE_OUTPUT(_noiseout);
+	OVERSAMPLE_NOISE_OUTPUT(_noiseout, SYS_CYCLES());
 
 	uint32_t feed = GET_BIT(~_noise_LFSR, 17);
 	_noise_LFSR = ((_noise_LFSR << 1) | feed);	// 23-bit register (just ignore excess leading bits)
@@ -370,7 +349,7 @@ uint16_t WaveGenerator::noiseOutput() {
 
 uint16_t WaveGenerator::nullOutput0() { // see "docs/floating-waveform.txt" for background information
 
-	if (_floating_null_ts >= SYS_CYCLES()) {
+	if ((int32_t)(_floating_null_ts - SYS_CYCLES()) >= 0) {
 		return _floating_null_wf;
 	} else {
 		return 0;
@@ -595,7 +574,7 @@ uint16_t WaveGenerator::pulseOutput() {
 // ---------------------------------------------------------------------------------------------
 uint16_t WaveGenerator::triangleSawOutput() {
 	// TRIANGLE & SAW - like in Garden_Party.sid
-	uint16_t o = combinedWF(_wave_table.TriSaw_8580, _counter >> 12, 1);			// 12 MSB needed
+	uint16_t o = combinedWF(_wave_table->TriSaw_8580, _counter >> 12, 1);			// 12 MSB needed
 	SAMPLE_END();
 	return o;
 }
@@ -617,7 +596,7 @@ uint16_t WaveGenerator::pulseTriangleOutput() {
 	// sound has none of the crispness nor volume of the original
 
 	uint32_t c = GET_RINGMOD_COUNTER();
-	uint16_t o =  plsout ? combinedWF(_wave_table.PulseTri_8580, (c ^ (c & 0x800000 ? 0xffffff : 0)) >> 11, 0) : 0;	// either on or off
+	uint16_t o =  plsout ? combinedWF(_wave_table->PulseTri_8580, (c ^ (c & 0x800000 ? 0xffffff : 0)) >> 11, 0) : 0;	// either on or off
 
 	SAMPLE_END();
 	return o;
@@ -630,11 +609,11 @@ uint16_t WaveGenerator::pulseTriangleSawOutput() {
 	uint32_t tmp, pw;	// 16 bits used
 	calcPulseBase(&tmp, &pw);
 	plsout =  ((tmp >= pw) || _test_bit) ? 0xffff : 0; //(this would be enough for simple but aliased-at-high-pitches pulse)
-	uint16_t o =  plsout ? combinedWF(_wave_table.PulseTriSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
+	uint16_t o =  plsout ? combinedWF(_wave_table->PulseTriSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
 #else
 //	plsout = createPulseOutput();	// plain should be good enough
 	plsout =  ((_counter >> 12 >= _pulse_width) || _test_bit) ? 0xffff : 0;
-	uint16_t o =  plsout ? combinedWF(_wave_table.PulseTriSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
+	uint16_t o =  plsout ? combinedWF(_wave_table->PulseTriSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
 #endif
 	SAMPLE_END();
 	return o;
@@ -647,11 +626,11 @@ uint16_t WaveGenerator::pulseSawOutput() {
 	uint32_t tmp, pw;	// 16 bits used
 	calcPulseBase(&tmp, &pw);
 	plsout =  ((tmp >= pw) || _test_bit) ? 0xffff : 0; //(this would be enough for simple but aliased-at-high-pitches pulse)
-	uint16_t o =   plsout ? combinedWF(_wave_table.PulseSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
+	uint16_t o =   plsout ? combinedWF(_wave_table->PulseSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
 #else
 //	plsout = createPulseOutput();	// plain should be good enough
 	plsout =  ((_counter >> 12 >= _pulse_width) || _test_bit) ? 0xffff : 0;
-	uint16_t o =   plsout ? combinedWF(_wave_table.PulseSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
+	uint16_t o =   plsout ? combinedWF(_wave_table->PulseSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
 #endif
 	SAMPLE_END();
 	return o;
@@ -661,7 +640,7 @@ uint16_t WaveGenerator::pulseSawOutput() {
 // in commented jsSID.js for background info): I did not thoroughly check how well
 // this really works (it works well enough for Kentilla and Clique_Baby (apparently
 // this one has to sound as shitty as it does)
-uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t differ6581) {
+uint16_t WaveGenerator::combinedWF(const uint16_t* wfarray, uint16_t index, uint8_t differ6581) {
 	//on 6581 most combined waveforms are essentially halved 8580-like waves
 
 	if (differ6581 && _sid->_is_6581) index &= 0x7ff;	// todo: add getter for _sid var or replicate into WaveGenerator
@@ -677,48 +656,39 @@ uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t diff
 	return (uint16_t)combiwf;
 }
 
-// rather dispatch once here than repeat the checks for each
-// sample.. note: once again the effects of the browser's "random performance behavior"
-// seem to be bigger than the eventual optimization effects achieved here, i.e.
-// the exact same version may run 30% faster/slower between successive runs (due to whatever
-// other shit the browser might be doing in the background - or maybe due to other Win10
-// processes interfering with the measurements..)
-#define SET_OUTPUT_FUNC(wf_bits) \
-	switch (wf_bits) {\
-		case 0:\
-			getOutput = &WaveGenerator::nullOutput;\
-			break;\
-		case TRI_BITMASK:\
-			getOutput = &WaveGenerator::triangleOutput;\
-			break;\
-		case SAW_BITMASK:\
-			getOutput = &WaveGenerator::sawOutput;\
-			break;\
-		case PULSE_BITMASK:\
-			getOutput = &WaveGenerator::pulseOutput;\
-			break;\
-		case NOISE_BITMASK:\
-			getOutput = &WaveGenerator::noiseOutput;\
-			break;\
-					\
-		/* commonly used combined waveforms */\
-		case TRI_BITMASK|SAW_BITMASK:\
-			getOutput = &WaveGenerator::triangleSawOutput;\
-			break;\
-		case PULSE_BITMASK|TRI_BITMASK:\
-			getOutput = &WaveGenerator::pulseTriangleOutput;\
-			break;\
-		case PULSE_BITMASK|TRI_BITMASK|SAW_BITMASK:\
-			getOutput = &WaveGenerator::pulseTriangleSawOutput;\
-			break;\
-		case PULSE_BITMASK|SAW_BITMASK:\
-			getOutput = &WaveGenerator::pulseSawOutput;\
-			break;\
-					\
-		default:\
-			getOutput = &WaveGenerator::noiseOutput;\
-			break;\
+// rather dispatch here once than repeat the checks in each of the below
+// waveform impls. note: once again the effects of the browser's "random
+// performance behavior" seem to be bigger than the eventual optimization effects
+// achieved here..
+uint16_t WaveGenerator::getOutput() {
+	// a plain switch allows the compiler to inline the specific impls (the
+	// previously used member-function pointer could not be inlined)
+	switch (_wf_bits) {
+		case 0:
+			return nullOutput();
+		case TRI_BITMASK:
+			return triangleOutput();
+		case SAW_BITMASK:
+			return sawOutput();
+		case PULSE_BITMASK:
+			return pulseOutput();
+		case NOISE_BITMASK:
+			return noiseOutput();
+
+		/* commonly used combined waveforms */
+		case TRI_BITMASK|SAW_BITMASK:
+			return triangleSawOutput();
+		case PULSE_BITMASK|TRI_BITMASK:
+			return pulseTriangleOutput();
+		case PULSE_BITMASK|TRI_BITMASK|SAW_BITMASK:
+			return pulseTriangleSawOutput();
+		case PULSE_BITMASK|SAW_BITMASK:
+			return pulseSawOutput();
+
+		default:
+			return noiseOutput();
 	}
+}
 
 uint8_t	WaveGenerator::getOsc() {
 	// What is sometimes incorrectly referred to as the "value of the oscillator" is indeed
@@ -750,11 +720,9 @@ uint8_t	WaveGenerator::getOsc() {
 }
 
 
-WaveGenerator::WaveGenerator(SID* sid, uint8_t voice_idx) {
+void WaveGenerator::init(SID* sid, uint8_t voice_idx) {
 	_sid = sid;
 	_voice_idx = voice_idx;
-
-//	reset();
 }
 
 void WaveGenerator::reset(double cycles_per_sample) {
@@ -780,8 +748,6 @@ void WaveGenerator::reset(double cycles_per_sample) {
 	setMute(0);
 
 	_floating_null_wf = 0;
-
-	getOutput = &WaveGenerator::nullOutput;
 }
 
 void WaveGenerator::setMute(uint8_t is_muted) {
@@ -802,7 +768,7 @@ void WaveGenerator::setWave(const uint8_t new_ctrl) {
 	if (_wf_bits && (new_wf_bits == 0)) {
 		// when WF selector is set to 0, the output enters into a "floating mode"
 		// (see "docs/floating-waveform.txt" for details)
-		_floating_null_wf = ((this)->*(this->getOutput))();// crappy C++ syntax for calling the "getOutput" method;
+		_floating_null_wf = getOutput();
 		_floating_null_ts = SYS_CYCLES() + NULL_FLOAT_DURATION;
 	} else {
 		INIT_NOISE_OVERSAMPLING(old_noise_bit, new_noise_bit);
@@ -827,8 +793,6 @@ void WaveGenerator::setWave(const uint8_t new_ctrl) {
 	_sync_bit = new_ctrl & SYNC_BITMASK;
 	_ring_bit = new_ctrl & RING_BITMASK;
 	_noise_bit = new_noise_bit;
-
-	SET_OUTPUT_FUNC(_wf_bits);
 }
 
 void WaveGenerator::setPulseWidthLow(const uint8_t val) {
@@ -928,6 +892,73 @@ void WaveGenerator::clockPhase1() {
 	}
 }
 
+uint8_t WaveGenerator::isBatchable() {
+	// a voice can be clocked in one go as long as it does not get hard synced (see
+	// clockPhase2()) and no combined-WF output feeds back into the noise
+	// generator (see CLOCK_NOISE_GENERATOR)
+
+	if (_sync_bit && _sid->getWaveGenerator(PREV_IDX(_voice_idx))->_freq) return 0;
+
+	return !_noise_bit || (_wf_bits == NOISE_BITMASK);
+}
+
+void WaveGenerator::clockCycles(uint32_t start_ts, uint32_t end_ts) {
+	// performance optimization: advance the oscillator by the specified number of
+	// cycles at once (with the same result as repeated clockPhase1() calls)
+
+	// note: the timestamps wrap around (after about 72 minutes), i.e. only the
+	// offsets relative to start_ts can be compared
+	const uint32_t cycles = end_ts - start_ts;
+
+	if (_test_bit) {
+		if ((uint32_t)(_noise_reset_ts - start_ts) < cycles) {
+			refillNoiseShiftRegister();
+		}
+		return;
+	}
+	if (!cycles) return;
+
+	uint32_t done = 0;	// cycles clocked so far
+
+	if (_noise_bit) {
+		// the noise shift-register is shifted 2 cycles after each rising edge of
+		// accumulator bit 19 (there is at most one such edge per cycle and at
+		// least 16 cycles between two edges)
+		while (done < cycles) {
+			if (!_trigger_noise_shift) {
+				if (!_freq) break;
+
+				uint32_t low = _counter & 0xfffff;
+				uint32_t dist = (low < 0x80000) ? 0x80000 - low : 0x180000 - low;
+				uint32_t edge = done + (dist + _freq - 1) / _freq - 1;
+
+				if (edge >= cycles) break;
+
+				_counter = (_counter + (edge - done + 1) * _freq) & 0xffffff;
+				done = edge + 1;
+
+				_trigger_noise_shift = 2;
+			} else {
+				uint32_t shift = done + _trigger_noise_shift - 1;
+
+				if (shift >= cycles) {
+					_trigger_noise_shift -= cycles - done;
+					break;
+				}
+				_counter = (_counter + (shift - done + 1) * _freq) & 0xffffff;
+				done = shift + 1;
+
+				_trigger_noise_shift = 0;
+				shiftNoiseRegisterNoTestBit(start_ts + shift);
+			}
+		}
+	}
+	_counter = (_counter + (cycles - done) * _freq) & 0xffffff;	// overflow is harmless here
+
+	// base for hard sync (i.e. as set by the last clocked cycle)
+	_msb_rising = (_counter & 0x800000) > (((_counter - _freq) & 0xffffff) & 0x800000);
+}
+
 void WaveGenerator::clockPhase2() {
 	// sync the oscillators: "hard sync" is accomplished by clearing the accumulator
 	// of an oscillator based on the accumulator MSB of the previous oscillator.
@@ -19,10 +19,22 @@
 
 
 class WaveGenerator {
+public:
+	/**
+	* Replaces the built-in "combined waveform" tables (see src/combinedwf.h), e.g.
+	* with tables measured on a specific chip. The tables are used by all the SIDs
+	* of the calling thread and should be replaced before a song is started.
+	*
+	* @param buf 4 tables of 4096 16-bit little endian values (TriSaw, PulseSaw, PulseTri
+	*            and PulseTriSaw - see "websid-wftables -b") or 0 to restore the built-in tables
+	* @return 0 on success
+	*/
+	static uint8_t loadCombinedWaveforms(const uint8_t* buf, uint32_t len);
+
 protected:
 	friend class SID;								// the only user of Voice
 
-	WaveGenerator(class SID* sid, uint8_t voice_idx);
+	void init(class SID* sid, uint8_t voice_idx);	// see DigiDetector::init()
 
 	void reset(double cycles_per_sample);
 
@@ -30,6 +42,11 @@ protected:
 	void		clockPhase1();
 	void		clockPhase2();
 
+	// performance optimization: same as clockPhase1() for cycles start_ts..end_ts-1
+	// (only usable while isBatchable())
+	uint8_t		isBatchable();
+	void		clockCycles(uint32_t start_ts, uint32_t end_ts);
+
 	void		setMute(uint8_t is_muted);
 	uint8_t		isMuted();
 
@@ -46,13 +63,13 @@ protected:
 	uint16_t	getFreq();
 
 	// waveform generation
-	uint16_t	(WaveGenerator::*getOutput)();	// try to save additional wrapper by using pointer directly..
+	uint16_t	getOutput();
 	uint8_t		getOsc();
 
 private:
 	// utils for waveform generation
 	void		updateFreqCache();
-	uint16_t	combinedWF(double* wfarray, uint16_t index, uint8_t differ6581);
+	uint16_t	combinedWF(const uint16_t* wfarray, uint16_t index, uint8_t differ6581);
 	uint16_t	createTriangleOutput();
 	uint16_t	createSawOutput();
 
@@ -66,7 +83,7 @@ private:
 	void		activateNoiseOutput();
 	uint16_t	combinedNoiseInput();
 
-	void 		shiftNoiseRegisterNoTestBit();
+	void 		shiftNoiseRegisterNoTestBit(uint32_t ts);
 	void 		shiftNoiseRegisterTestBitDriven(const uint8_t new_ctrl);
 
 	void 		feedbackNoise(uint16_t out);
@@ -75,7 +92,7 @@ private:
 	void		refillNoiseShiftRegister();
 
 
-	// functions for specific waveform combinations (used via getOutput)
+	// functions for specific waveform combinations (used by getOutput)
 	uint16_t nullOutput();
 	uint16_t nullOutput0();
 	uint16_t triangleOutput();
@@ -148,7 +165,7 @@ private:
 
 
 	// add-ons snatched from Hermit's implementation
-	double		_prev_wav_data;		// combined waveform handling
+	uint16_t	_prev_wav_data;		// combined waveform handling
 
 	// floating wavegen
 	uint16_t 	_floating_null_wf;
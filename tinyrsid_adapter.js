@@ -612,6 +612,36 @@ class SIDBackendAdapter extends EmsHEAP16BackendAdapter {
         return result;
     }
 
+    /**
+    * Use the cheaper fixed-point impl of the filter (should be set before a song is started).
+    */
+    setFixedPointFilter(on) {
+        this.Module.ccall('setFixedPointFilter', 'number', ['number'], [on ? 1 : 0]);
+    }
+
+    isFixedPointFilter() {
+        return this.Module.ccall('isFixedPointFilter', 'number') != 0;
+    }
+
+    /**
+    * Replaces the built-in "combined waveform" tables, e.g. with tables measured on a
+    * specific chip (should be done before a song is started).
+    *
+    * @param data Uint8Array with 4 tables of 4096 16-bit little endian values (see
+    *             "websid-wftables -b") or null to restore the built-in tables
+    * @return true on success
+    */
+    loadCombinedWaveforms(data) {
+        if (!data) {
+            return this.Module.ccall('loadCombinedWaveforms', 'number', ['number', 'number'], [0, 0]) == 0;
+        }
+        var buf = this.Module._malloc(data.length);
+        this.Module.HEAPU8.set(data, buf);
+        var ret = this.Module.ccall('loadCombinedWaveforms', 'number', ['number', 'number'], [buf, data.length]);
+        this.Module._free(buf);
+        return ret == 0;
+    }
+
     getCutoffsLength() {
         return this.cutoffSize;
     }